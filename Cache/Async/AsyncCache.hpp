@@ -0,0 +1,249 @@
+#pragma once
+
+#include <Cache/Async/Executor.hpp>
+#include <Cache/Concepts/CacheConcepts.hpp>
+#include <Cache/Concepts/StatsConcepts.hpp>
+#include <Cache/Stats/CacheStats.hpp>
+#include <Cache/Utils/NonCopyable.hpp>
+#include <chrono>
+#include <condition_variable>
+#include <coroutine>
+#include <cstddef>
+#include <exception>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <optional>
+#include <stdexcept>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+namespace cache::async
+{
+    // Awaitable front-end to a cache: `co_await async.getOrLoadAsync(key, loader)` completes
+    // at once on a hit; on a miss the coroutine is suspended while `loader(key)` runs on the
+    // executor, then resumed there with the value. Concurrent awaiters of a key share one
+    // in-flight load, and a loader exception reaches each of them without being cached.
+    // Loads are recorded in `Stats`. `Cache` is not owned; the destructor waits for the
+    // loads in flight.
+    template <typename Cache, typename Stats = stats::NoStats, typename Hash = std::hash<typename Cache::KeyType>,
+              typename Eq = std::equal_to<typename Cache::KeyType>>
+
+        requires concepts::CacheLike<Cache, typename Cache::KeyType, typename Cache::ValType> && concepts::StatsLike<Stats>
+
+    class AsyncCache final : public utils::NonCopyable
+    {
+      public:
+        using KeyType = typename Cache::KeyType;
+        using ValType = typename Cache::ValType;
+        using Loader  = std::function<ValType(const KeyType&)>;
+
+      private:
+        struct Flight
+        {
+            std::vector<std::coroutine_handle<>> waiters;
+            std::optional<ValType>               value;
+            std::exception_ptr                   error;
+            bool                                 done = false;
+        };
+
+      public:
+        class [[nodiscard]] LoadAwaiter
+        {
+          public:
+            [[nodiscard]] bool await_ready()
+            {
+                ValType value;
+                if (_owner._cache.get(_key, value))
+                {
+                    _hit = std::move(value);
+                    return true;
+                }
+                return false;
+            }
+
+            // Nothing may touch the awaiter once the load has been scheduled: it can complete,
+            // and the coroutine be resumed and destroyed, before this returns.
+            bool await_suspend(std::coroutine_handle<> handle)
+            {
+                return _owner.join(_key, _loader, handle, _flight);
+            }
+
+            ValType await_resume()
+            {
+                if (_hit)
+                {
+                    return std::move(*_hit);
+                }
+                if (_flight->error)
+                {
+                    std::rethrow_exception(_flight->error);
+                }
+                return *_flight->value;
+            }
+
+          private:
+            friend class AsyncCache;
+
+            LoadAwaiter(AsyncCache& owner, const KeyType& key, Loader loader) : _owner(owner), _key(key), _loader(std::move(loader))
+            { }
+
+            AsyncCache&             _owner;
+            KeyType                 _key;
+            Loader                  _loader;
+            std::optional<ValType>  _hit;
+            std::shared_ptr<Flight> _flight;
+        };
+
+        AsyncCache(Cache& cache, std::shared_ptr<IExecutor> executor) : _cache(cache), _executor(std::move(executor))
+        {
+            if (!_executor)
+            {
+                throw(std::invalid_argument("Cannot load asynchronously without an executor."));
+            }
+        }
+
+        ~AsyncCache() noexcept
+        {
+            std::unique_lock<std::mutex> lock(_mtx);
+            _idle.wait(lock, [this] { return _active == 0; });
+        }
+
+        LoadAwaiter getOrLoadAsync(const KeyType& key, Loader loader)
+        {
+            if (!loader)
+            {
+                throw(std::invalid_argument("Cannot load without a loader."));
+            }
+            return LoadAwaiter(*this, key, std::move(loader));
+        }
+
+        // Keys being loaded.
+        [[nodiscard]] std::size_t inFlight() const
+        {
+            std::lock_guard<std::mutex> lock(_mtx);
+            return _loading.size();
+        }
+
+        // The cache's counters, with the loads performed here.
+        [[nodiscard]] stats::Snapshot stats() const noexcept
+        {
+            stats::Snapshot res = _cache.stats();
+            res += _stats.snapshot();
+            return res;
+        }
+
+        [[nodiscard]] Cache& cache() noexcept
+        {
+            return _cache;
+        }
+
+      private:
+        // Registers `handle` as a waiter on the load of `key`, starting it if none is in
+        // flight. Returns false, for the coroutine to go on at once, when the load it started
+        // has already completed. The cache is not probed again: await_ready() recorded the
+        // miss, and a value put in the meantime wins over the loaded one in load().
+        bool join(const KeyType& key, Loader& loader, std::coroutine_handle<> handle, std::shared_ptr<Flight>& flight)
+        {
+            std::shared_ptr<Flight> started;
+            {
+                std::lock_guard<std::mutex> lock(_mtx);
+                if (auto it = _loading.find(key); it != _loading.end())
+                {
+                    it->second->waiters.push_back(handle);
+                    flight = it->second;
+                    return true;
+                }
+                started = std::make_shared<Flight>();
+                _loading.emplace(key, started);
+                ++_active;
+            }
+            flight = started;
+            // The starter only waits once the load is scheduled, so an inline executor never
+            // resumes it from inside its own await_suspend().
+            start(key, started, std::move(loader));
+            std::lock_guard<std::mutex> lock(_mtx);
+            if (started->done)
+            {
+                return false;
+            }
+            started->waiters.push_back(handle);
+            return true;
+        }
+
+        void start(KeyType key, std::shared_ptr<Flight> flight, Loader loader) noexcept
+        {
+            try
+            {
+                _executor->execute([this, key, flight, loader = std::move(loader)] { load(key, flight, loader); });
+            }
+            catch (...)
+            {
+                flight->error = std::current_exception();
+                finish(key, flight);
+            }
+        }
+
+        // A concurrent put() wins over the loaded value, which may predate it.
+        void load(const KeyType& key, const std::shared_ptr<Flight>& flight, const Loader& loader) noexcept
+        {
+            const auto start = std::chrono::steady_clock::now();
+            try
+            {
+                ValType value = loader(key);
+                _stats.recordLoadSuccess(std::chrono::steady_clock::now() - start);
+                if (!_cache.putIfAbsent(key, value))
+                {
+                    (void) _cache.get(key, value);
+                }
+                flight->value = std::move(value);
+            }
+            catch (...)
+            {
+                _stats.recordLoadFailure(std::chrono::steady_clock::now() - start);
+                flight->error = std::current_exception();
+            }
+            finish(key, flight);
+        }
+
+        // Retires the load and resumes its waiters on the executor, inline should it fail.
+        void finish(const KeyType& key, const std::shared_ptr<Flight>& flight) noexcept
+        {
+            std::vector<std::coroutine_handle<>> waiters;
+            {
+                std::lock_guard<std::mutex> lock(_mtx);
+                if (auto it = _loading.find(key); it != _loading.end() && it->second == flight)
+                {
+                    _loading.erase(it);
+                }
+                waiters.swap(flight->waiters);
+                flight->done = true;
+            }
+            for (auto handle : waiters)
+            {
+                try
+                {
+                    _executor->execute([handle] { handle.resume(); });
+                }
+                catch (...)
+                {
+                    handle.resume();
+                }
+            }
+            std::lock_guard<std::mutex> lock(_mtx);
+            if (--_active == 0)
+            {
+                _idle.notify_all();
+            }
+        }
+
+        Cache&                                                         _cache;
+        std::shared_ptr<IExecutor>                                     _executor;
+        [[no_unique_address]] Stats                                    _stats;
+        mutable std::mutex                                             _mtx;
+        std::condition_variable                                        _idle;
+        std::unordered_map<KeyType, std::shared_ptr<Flight>, Hash, Eq> _loading;
+        std::size_t                                                    _active = 0;
+    };
+} // namespace cache::async
@@ -0,0 +1,111 @@
+#pragma once
+
+#include <Cache/Utils/NonCopyable.hpp>
+#include <algorithm>
+#include <condition_variable>
+#include <cstddef>
+#include <deque>
+#include <functional>
+#include <mutex>
+#include <thread>
+#include <utility>
+#include <vector>
+
+namespace cache::async
+{
+    // Where AsyncCache runs loads and resumes the coroutines awaiting them.
+    class IExecutor : public utils::NonCopyable
+    {
+      public:
+        virtual ~IExecutor() noexcept = default;
+
+        virtual void execute(std::function<void()> task) = 0;
+
+      protected:
+        constexpr explicit IExecutor() = default;
+    };
+
+    // Runs every task on the calling thread.
+    class InlineExecutor final : public IExecutor
+    {
+      public:
+        void execute(std::function<void()> task) override
+        {
+            task();
+        }
+    };
+
+    // Fixed set of worker threads sharing one FIFO queue. The destructor runs the tasks
+    // still queued, so no awaiting coroutine is left suspended, then joins the workers.
+    class ThreadPool final : public IExecutor
+    {
+      public:
+        explicit ThreadPool(std::size_t threads = std::max(1u, std::thread::hardware_concurrency()))
+        {
+            _workers.reserve(std::max<std::size_t>(1, threads));
+            for (std::size_t i = 0; i < std::max<std::size_t>(1, threads); ++i)
+            {
+                _workers.emplace_back([this] { run(); });
+            }
+        }
+
+        ~ThreadPool() noexcept override
+        {
+            {
+                std::lock_guard<std::mutex> lock(_mtx);
+                _stopping = true;
+            }
+            _ready.notify_all();
+            for (auto& worker : _workers)
+            {
+                worker.join();
+            }
+        }
+
+        void execute(std::function<void()> task) override
+        {
+            {
+                std::lock_guard<std::mutex> lock(_mtx);
+                _tasks.push_back(std::move(task));
+            }
+            _ready.notify_one();
+        }
+
+        [[nodiscard]] std::size_t size() const noexcept
+        {
+            return _workers.size();
+        }
+
+      private:
+        void run()
+        {
+            std::unique_lock<std::mutex> lock(_mtx);
+            while (true)
+            {
+                _ready.wait(lock, [this] { return _stopping || !_tasks.empty(); });
+                if (_tasks.empty())
+                {
+                    return;
+                }
+                std::function<void()> task = std::move(_tasks.front());
+                _tasks.pop_front();
+                lock.unlock();
+                try
+                {
+                    task();
+                }
+                catch (...)
+                {
+                    // A failing task must not take the worker down with it.
+                }
+                lock.lock();
+            }
+        }
+
+        std::mutex                        _mtx;
+        std::condition_variable           _ready;
+        std::deque<std::function<void()>> _tasks;
+        bool                              _stopping = false;
+        std::vector<std::thread>          _workers;
+    };
+} // namespace cache::async
@@ -1,74 +1,183 @@
 #pragma once
 
 #include <Cache/Concepts/CacheConcepts.hpp>
+#include <Cache/Concepts/StatsConcepts.hpp>
+#include <Cache/Concepts/WeigherConcepts.hpp>
 #include <Cache/Helpers/MutexLocks.hpp>
 #include <Cache/Interfaces/AStrategyCache.hpp>
-#include <Cache/Strategy/Interfaces/ICacheStrategy.hpp>
+#include <Cache/Listener/RemovalListener.hpp>
+#include <Cache/Memory/Arena.hpp>
+#include <Cache/Memory/CountingResource.hpp>
+#include <Cache/Memory/MemoryUsage.hpp>
+#include <Cache/Memory/SlabResource.hpp>
+#include <Cache/Stats/CacheStats.hpp>
+#include <Cache/Stats/MissRatioEstimator.hpp>
 #include <Cache/Strategy/LRU.hpp>
+#include <Cache/Trace/AccessTracer.hpp>
+#include <Cache/Weigher/Weighers.hpp>
+#include <algorithm>
+#include <concepts>
 #include <functional>
+#include <iterator>
 #include <memory>
+#include <memory_resource>
 #include <shared_mutex>
 #include <stdexcept>
+#include <type_traits>
 #include <unordered_map>
+#include <utility>
+#include <vector>
 
 namespace cache
 {
 
     template <typename K, typename V, typename Strategy = strategy::LRU<K, V>, typename Hash = std::hash<K>, typename Eq = std::equal_to<K>,
-              typename Mutex = std::shared_mutex>
+              typename Mutex = std::shared_mutex, typename Stats = stats::NoStats, typename Weigher = weigher::Unit>
 
-        requires concepts::StrategyLike<Strategy, K, V> && concepts::MutexLike<Mutex>
+        requires concepts::StrategyLike<Strategy, K, V> && concepts::MutexLike<Mutex> && concepts::StatsLike<Stats> && concepts::WeigherLike<Weigher, K, V>
 
     class Base final : public AStrategyCache<K, V>
     {
       public:
-        explicit Base(std::size_t cap = 128) : _capacity(cap)
+        using Removal = listener::Removal<K, V>;
+
+        // With a non-unit Weigher, `cap` is the maximum total weight of the entries. The map
+        // and the strategy allocate from `upstream`, through a private Arena with ARENA or a
+        // private SlabResource with SLAB; allocator-aware values (std::pmr::string, ...) are
+        // constructed from the same resource.
+        explicit Base(std::size_t cap = 128, std::pmr::memory_resource* upstream = std::pmr::get_default_resource(),
+                      memory::Allocation allocation = memory::Allocation::DIRECT)
+            : _arena(makeArena(allocation, upstream)),
+              _memory(_arena ? _arena.get() : upstream),
+              _capacity(cap),
+              _strategy(makeStrategy(_memory.upstream()))
         {
             if (cap < 1)
             {
                 throw(std::invalid_argument("Cannot give null capacity."));
             }
-            _strategy = std::make_unique<Strategy>();
-            _map.reserve(_capacity);
-            _strategy->reserve(_capacity);
+            if constexpr (_unitWeight)
+            {
+                _map.reserve(_capacity);
+                _strategy.reserve(_capacity);
+            }
         }
 
         virtual ~Base() noexcept override = default;
 
         [[nodiscard]] virtual bool get(const K& key, V& cacheOut) override
         {
-            mutex_locks::WriteLock<decltype(_mtx)> wlock(_mtx);
-            auto                                   it = _map.find(key);
+            stats::LatencyTimer<Stats> timer(_stats, stats::Op::GET);
+            RetiringLock               wlock(*this);
+            if (_weight > _capacity) [[unlikely]]
+            {
+                trimUnlocked();
+            }
+            if (_missRatio) [[unlikely]]
+            {
+                _missRatio->access(Hash{}(key));
+            }
+            auto it = _map.find(key);
             if (it == _map.end())
             {
+                _stats.recordMiss();
+                traceUnlocked(trace::Op::GET, key, false, 0);
                 return false;
             }
-            if (!_strategy->onAccess(key))
+            if (!_strategy.onAccess(key))
             {
                 clearUnlocked();
+                _stats.recordMiss();
+                traceUnlocked(trace::Op::GET, key, false, 0);
                 return false;
             }
-            if (_invalidateCallback && _invalidateCallback(key, it->second))
+            if (isInvalidatedUnlocked(key, it))
             {
-                _map.erase(it);
-                (void) _strategy->onRemove(key);
+                _stats.recordMiss();
+                traceUnlocked(trace::Op::GET, key, false, 0);
                 return false;
             }
             cacheOut = it->second;
+            _stats.recordHit();
+            traceUnlocked(trace::Op::GET, key, true, trace::valueSize(cacheOut));
             return true;
         }
 
         virtual void put(const K& key, const V& value) override
         {
-            mutex_locks::WriteLock<decltype(_mtx)> wlock(_mtx);
+            stats::LatencyTimer<Stats> timer(_stats, stats::Op::PUT);
+            RetiringLock               wlock(*this);
+            if (_tracer) [[unlikely]]
+            {
+                traceUnlocked(trace::Op::PUT, key, _map.contains(key), trace::valueSize(value));
+            }
             (void) putUnlocked(key, value);
         }
 
+        // Moves `value` in and appends every entry the put drops (evicted to make room, or
+        // the value it overwrites) to `reclaimed`, so their buffers can be reused for the next
+        // value instead of being freed. These entries bypass the removal listener. Returns
+        // whether the value was stored.
+        bool putReclaim(const K& key, V&& value, std::vector<Removal>& reclaimed)
+        {
+            stats::LatencyTimer<Stats> timer(_stats, stats::Op::PUT);
+            RetiringLock               wlock(*this);
+            if (_tracer) [[unlikely]]
+            {
+                traceUnlocked(trace::Op::PUT, key, _map.contains(key), trace::valueSize(value));
+            }
+            const std::size_t mark   = _retired.size();
+            bool              stored = false;
+            _reclaiming              = true;
+            try
+            {
+                stored = putUnlocked(key, std::move(value));
+            }
+            catch (...)
+            {
+                _reclaiming = false;
+                throw;
+            }
+            _reclaiming = false;
+            if (mark == 0 && reclaimed.empty())
+            {
+                reclaimed.swap(_retired);
+            }
+            else
+            {
+                reclaimed.insert(reclaimed.end(), std::make_move_iterator(_retired.begin() + mark), std::make_move_iterator(_retired.end()));
+                _retired.resize(mark);
+            }
+            return stored;
+        }
+
+        // Same, handing each dropped entry to `reclaim` (an object pool, say) once the lock
+        // has been released.
+        template <typename Reclaim>
+            requires std::invocable<Reclaim&, Removal&&>
+        bool putReclaim(const K& key, V&& value, Reclaim&& reclaim)
+        {
+            std::vector<Removal> reclaimed;
+            const bool           stored = putReclaim(key, std::move(value), reclaimed);
+            for (auto& removal : reclaimed)
+            {
+                reclaim(std::move(removal));
+            }
+            return stored;
+        }
+
         virtual void remove(const K& key) override
         {
-            mutex_locks::WriteLock<decltype(_mtx)> wlock(_mtx);
-            _map.erase(key);
-            if (!_strategy->onRemove(key))
+            RetiringLock wlock(*this);
+            auto         it       = _map.find(key);
+            const bool   erased   = it != _map.end();
+            const bool   detached = _strategy.onRemove(key);
+            if (erased)
+            {
+                eraseUnlocked(it, listener::Cause::EXPLICIT);
+            }
+            traceUnlocked(trace::Op::REMOVE, key, erased, 0);
+            if (!detached)
             {
                 clearUnlocked();
             }
@@ -94,8 +203,12 @@ namespace cache
 
         virtual void clear() noexcept override
         {
-            mutex_locks::WriteLock<decltype(_mtx)> wlock(_mtx);
+            RetiringLock wlock(*this);
             clearUnlocked();
+            if (_arena)
+            {
+                releaseArenaUnlocked();
+            }
         }
 
         [[nodiscard]] virtual std::size_t size() const noexcept override
@@ -106,9 +219,52 @@ namespace cache
 
         [[nodiscard]] virtual std::size_t capacity() const noexcept override
         {
+            mutex_locks::ReadLock<decltype(_mtx)> rlock(_mtx);
             return _capacity;
         }
 
+        // Total weight of the cached entries; equals size() with the default Weigher.
+        [[nodiscard]] std::size_t weight() const noexcept
+        {
+            mutex_locks::ReadLock<decltype(_mtx)> rlock(_mtx);
+            return _weight;
+        }
+
+        // Takes effect for the next insert; when shrinking, the excess is evicted at most
+        // `_evictionBatch` entries per get()/put() rather than all at once.
+        virtual void setCapacity(std::size_t cap) override
+        {
+            if (cap < 1)
+            {
+                throw(std::invalid_argument("Cannot give null capacity."));
+            }
+            RetiringLock wlock(*this);
+            const bool   grow = cap > _capacity;
+
+            _capacity      = cap;
+            _strategySized = false;
+            if (grow)
+            {
+                if constexpr (_unitWeight)
+                {
+                    _map.reserve(_capacity);
+                    _strategy.reserve(_capacity);
+                }
+            }
+            else if (_weight > _capacity)
+            {
+                if constexpr (_unitWeight)
+                {
+                    _strategy.reserve(_capacity);
+                }
+                trimUnlocked();
+            }
+            else
+            {
+                fitUnlocked();
+            }
+        }
+
         [[nodiscard]] virtual bool isMtSafe() const noexcept override
         {
             if constexpr (std::is_same_v<Mutex, mutex_locks::NoLock>)
@@ -118,14 +274,83 @@ namespace cache
             return true;
         }
 
+        [[nodiscard]] virtual stats::Snapshot stats() const noexcept override
+        {
+            return _stats.snapshot();
+        }
+
+        // Payload is the keys and values in the map; everything else the map and the strategy
+        // allocate is overhead. Heap contents of keys and values are found by walking the entries;
+        // allocator-aware ones were allocated from `_memory` and are taken out of the overhead.
+        [[nodiscard]] virtual memory::Usage memoryUsage() const override
+        {
+            mutex_locks::ReadLock<decltype(_mtx)> rlock(_mtx);
+            const std::size_t                     entryBytes = _map.size() * (sizeof(K) + sizeof(V));
+            memory::Usage                         res{entryBytes, sizeof(*this) + _memory.bytes() - entryBytes, _memory.blocks()};
+            if constexpr (memory::OwnsHeap<K> || memory::OwnsHeap<V>)
+            {
+                constexpr bool keyInMap = std::uses_allocator_v<K, typename MapType::allocator_type>;
+                constexpr bool valInMap = std::uses_allocator_v<V, typename MapType::allocator_type>;
+                for (const auto& [key, value] : _map)
+                {
+                    const std::size_t keyHeap = memory::heapBytes(key);
+                    const std::size_t valHeap = memory::heapBytes(value);
+                    res.payloadBytes += keyHeap + valHeap;
+                    res.overheadBytes -= (keyInMap ? keyHeap : 0) + (valInMap ? valHeap : 0);
+                }
+            }
+            if constexpr (requires { _strategy.memoryUsage(); })
+            {
+                res += _strategy.memoryUsage();
+            }
+            return res;
+        }
+
+        virtual void setRemovalListener(listener::Listener<K, V> listener) override
+        {
+            auto                                   shared = listener ? std::make_shared<const listener::Listener<K, V>>(std::move(listener)) : nullptr;
+            mutex_locks::WriteLock<decltype(_mtx)> wlock(_mtx);
+            _listener = std::move(shared);
+        }
+
+        // For a wrapper driving this cache under its own lock (see Shared): dropped entries are
+        // kept until takeRetired() hands them over, to be reported and destroyed once the
+        // wrapper's lock has been released.
+        void retainRetired(bool retain) noexcept
+        {
+            mutex_locks::WriteLock<decltype(_mtx)> wlock(_mtx);
+            _retainRetired = retain;
+        }
+
+        void takeRetired(listener::Retired<K, V>& out) noexcept
+        {
+            mutex_locks::WriteLock<decltype(_mtx)> wlock(_mtx);
+            out.take(_retired, _listener);
+        }
+
+        // Attaches (or, with nullptr, detaches) an access tracer; see trace::AccessTracer.
+        void setTracer(std::shared_ptr<trace::AccessTracer> tracer)
+        {
+            mutex_locks::WriteLock<decltype(_mtx)> wlock(_mtx);
+            _tracer = std::move(tracer);
+        }
+
+        // Feeds every get() to a SHARDS miss ratio estimator; nullptr detaches it.
+        void setMissRatioEstimator(std::shared_ptr<stats::MissRatioEstimator> estimator)
+        {
+            mutex_locks::WriteLock<decltype(_mtx)> wlock(_mtx);
+            _missRatio = std::move(estimator);
+        }
+
       protected:
         using PutRequirement = typename AStrategyCache<K, V>::PutRequirement;
 
         [[nodiscard]] bool putConditional(const K& key, const V& value, PutRequirement req) override
         {
-            mutex_locks::WriteLock<decltype(_mtx)> wlock(_mtx);
-            auto                                   it      = _map.find(key);
-            bool                                   present = it != _map.end();
+            stats::LatencyTimer<Stats> timer(_stats, stats::Op::PUT);
+            RetiringLock               wlock(*this);
+            auto                       it      = _map.find(key);
+            bool                       present = it != _map.end();
 
             if (present && isInvalidatedUnlocked(key, it))
             {
@@ -142,13 +367,13 @@ namespace cache
 
         [[nodiscard]] bool checkContains(const K& key, bool countAsAccess) override
         {
-            mutex_locks::WriteLock<decltype(_mtx)> wlock(_mtx);
-            auto                                   it = _map.find(key);
+            RetiringLock wlock(*this);
+            auto         it = _map.find(key);
             if (it == _map.end())
             {
                 return false;
             }
-            if (countAsAccess && !_strategy->onAccess(key))
+            if (countAsAccess && !_strategy.onAccess(key))
             {
                 clearUnlocked();
                 return false;
@@ -157,68 +382,366 @@ namespace cache
         }
 
       private:
-        using MapType     = std::unordered_map<K, V, Hash, Eq>;
+        using MapType     = std::pmr::unordered_map<K, V, Hash, Eq>;
         using MapIterator = typename MapType::iterator;
 
-        bool putUnlocked(const K& key, const V& value)
+        // Write lock for operations that may drop entries: the keys and values they unlink
+        // are parked in `_retired`, then reported and destroyed once the lock has been released.
+        class RetiringLock
         {
-            auto it = _map.find(key);
+          public:
+            explicit RetiringLock(Base& cache) : _cache(cache), _lock(cache.writeLock())
+            { }
+
+            ~RetiringLock() noexcept
+            {
+                if (!_cache._retainRetired)
+                {
+                    _dead.take(_cache._retired, _cache._listener);
+                }
+            }
+
+          private:
+            listener::Retired<K, V>       _dead;
+            Base&                         _cache;
+            mutex_locks::WriteLock<Mutex> _lock;
+        };
+
+        // Moves a key or value out of a node about to be freed. Allocator-aware ones are copied
+        // to the default resource instead: `_memory` must not be used outside the lock.
+        template <typename T>
+        static T detach(T& item)
+        {
+            if constexpr (std::uses_allocator_v<T, std::pmr::polymorphic_allocator<T>>)
+            {
+                return std::make_obj_using_allocator<T>(std::pmr::polymorphic_allocator<T>(std::pmr::get_default_resource()), std::move(item));
+            }
+            else
+            {
+                return std::move(item);
+            }
+        }
+
+        static Strategy makeStrategy(std::pmr::memory_resource* upstream)
+        {
+            if constexpr (std::is_constructible_v<Strategy, std::pmr::memory_resource*>)
+            {
+                return Strategy(upstream);
+            }
+            else
+            {
+                return Strategy();
+            }
+        }
+
+        static std::unique_ptr<memory::ReleasableResource> makeArena(memory::Allocation allocation, std::pmr::memory_resource* upstream)
+        {
+            if (allocation == memory::Allocation::ARENA)
+            {
+                return std::make_unique<memory::Arena>(upstream);
+            }
+            if (allocation == memory::Allocation::SLAB)
+            {
+                return std::make_unique<memory::SlabResource>(upstream);
+            }
+            return nullptr;
+        }
+
+        [[nodiscard]] mutex_locks::WriteLock<Mutex> writeLock()
+        {
+            if constexpr (std::is_same_v<Mutex, mutex_locks::NoLock>)
+            {
+                return mutex_locks::WriteLock<Mutex>(_mtx);
+            }
+            else
+            {
+                return stats::timedLock<mutex_locks::WriteLock<Mutex>>(_mtx, _stats);
+            }
+        }
+
+        void traceUnlocked(trace::Op op, const K& key, bool hit, std::uint32_t valueSize) const
+        {
+            if (_tracer) [[unlikely]]
+            {
+                _tracer->record(op, Hash{}(key), valueSize, hit);
+            }
+        }
+
+        [[nodiscard]] std::size_t weigh(const K& key, const V& value) const
+        {
+            return static_cast<std::size_t>(_weigher(key, value));
+        }
+
+        template <typename T>
+        bool putUnlocked(const K& key, T&& value)
+        {
+            const std::size_t weight = weigh(key, value);
+            auto              it     = _map.find(key);
             if (it != _map.end())
             {
-                it->second = value;
-                if (!_strategy->onAccess(key))
+                if (weight > _capacity)
+                {
+                    const bool detached = _strategy.onRemove(key);
+                    eraseUnlocked(it, listener::Cause::SIZE);
+                    if (!detached)
+                    {
+                        clearUnlocked();
+                    }
+                    return false;
+                }
+                // The stored value is weighed rather than `value`: assigning may keep the old
+                // buffer, and eraseUnlocked() subtracts what is stored.
+                const std::size_t limit    = std::max(_capacity, _weight);
+                const std::size_t replaced = weigh(it->first, it->second);
+                if (_listener || _reclaiming)
+                {
+                    retireValueUnlocked(it, listener::Cause::REPLACED);
+                }
+                it->second = std::forward<T>(value);
+                _weight    = _weight - replaced + weigh(it->first, it->second);
+                if (!_strategy.onAccess(key))
                 {
                     clearUnlocked();
                     return false;
                 }
+                while (_weight > limit && evictOneUnlocked())
+                {
+                }
+                _stats.recordPut();
                 return true;
             }
-            if (_map.size() >= _capacity)
+            if (weight > _capacity)
+            {
+                return false;
+            }
+            if (_weight > _capacity) [[unlikely]]
+            {
+                trimUnlocked();
+            }
+            // While a shrink is still being trimmed the cache is over capacity; an insert then
+            // only has to free its own weight so the total does not grow.
+            const std::size_t limit = std::max(_capacity, _weight);
+            if (_weight + weight > limit)
             {
-                auto evictKey = _strategy->selectForEviction();
-                if (evictKey)
+                if constexpr (!_unitWeight)
                 {
-                    _map.erase(*evictKey);
-                    if (!_strategy->onRemove(*evictKey))
+                    if (!_strategySized)
                     {
-                        clearUnlocked();
+                        _strategy.reserve(_map.size());
+                        _strategySized = true;
                     }
                 }
+                while (_weight + weight > limit && evictOneUnlocked())
+                {
+                }
             }
-            if (_map.size() < _capacity)
+            if (_weight + weight <= limit)
             {
-                _map[key] = value;
-                if (!_strategy->onInsert(key))
+                // The strategy may keep a pointer to the key stored in the node (see keys::Handle).
+                const auto node = _map.emplace(key, std::forward<T>(value)).first;
+                _weight += weigh(node->first, node->second);
+                if (!_strategy.onInsert(node->first))
                 {
                     clearUnlocked();
                     return false;
                 }
+                _stats.recordPut();
                 return true;
             }
             return false;
         }
 
+        void eraseUnlocked(MapIterator it, listener::Cause cause)
+        {
+            _weight -= weigh(it->first, it->second);
+            retireUnlocked(it, cause);
+        }
+
+        // Unlinks the node. When destruction is deferred, a listener is attached or putReclaim()
+        // collects the entry, its key and value are moved to `_retired` to be dealt with after
+        // unlocking; the node itself is freed here, as the map's resource is only used under
+        // the lock. Should memory run out the entry is simply destroyed in place, unreported.
+        void retireUnlocked(MapIterator it, listener::Cause cause) noexcept
+        {
+            if (!_deferDestruction && !_listener && !_reclaiming)
+            {
+                _map.erase(it);
+                return;
+            }
+            auto node = _map.extract(it);
+            try
+            {
+                reserveRetiredUnlocked(1);
+                _retired.push_back(Removal{detach(node.key()), detach(node.mapped()), cause});
+            }
+            catch (...)
+            {
+            }
+        }
+
+        // Reports the value of a live entry that is about to be overwritten.
+        void retireValueUnlocked(MapIterator it, listener::Cause cause) noexcept
+        {
+            try
+            {
+                reserveRetiredUnlocked(1);
+                _retired.push_back(Removal{it->first, detach(it->second), cause});
+            }
+            catch (...)
+            {
+            }
+        }
+
+        void reserveRetiredUnlocked(std::size_t n)
+        {
+            if (_retired.size() + n > _retired.capacity())
+            {
+                _retired.reserve(std::max({std::size_t(8), 2 * _retired.capacity(), _retired.size() + n}));
+            }
+        }
+
+        bool evictOneUnlocked()
+        {
+            auto evictKey = _strategy.selectForEviction();
+            if (!evictKey)
+            {
+                return false;
+            }
+            // Detach the strategy first: it may still reference the key owned by the node.
+            const bool detached = _strategy.onRemove(*evictKey);
+            if (auto it = _map.find(*evictKey); it != _map.end())
+            {
+                eraseUnlocked(it, listener::Cause::SIZE);
+            }
+            _stats.recordEviction();
+            if (!detached)
+            {
+                clearUnlocked();
+            }
+            return true;
+        }
+
+        // Evicts at most one batch of the entries above capacity; once the excess is gone the
+        // map and the strategy are fitted to the new capacity.
+        void trimUnlocked()
+        {
+            for (std::size_t budget = _evictionBatch; budget > 0 && _weight > _capacity; --budget)
+            {
+                if (!evictOneUnlocked())
+                {
+                    break;
+                }
+            }
+            if (_weight <= _capacity)
+            {
+                fitUnlocked();
+            }
+        }
+
+        // Strategies are sized in entries: a weighted cache sizes them from the entry count
+        // it holds once its weight budget is reached.
+        void fitUnlocked()
+        {
+            memory::shrink(_map, _unitWeight ? _capacity : _map.size());
+            if constexpr (_unitWeight)
+            {
+                _strategy.reserve(_capacity);
+            }
+            else
+            {
+                _strategy.reserve(std::max<std::size_t>(1, _map.size()));
+                _strategySized = true;
+            }
+        }
+
         [[nodiscard]] bool isInvalidatedUnlocked(const K& key, MapIterator it)
         {
             if (!_invalidateCallback || !_invalidateCallback(key, it->second))
             {
                 return false;
             }
-            _map.erase(it);
-            (void) _strategy->onRemove(key);
+            (void) _strategy.onRemove(key);
+            eraseUnlocked(it, listener::Cause::INVALIDATED);
+            _stats.recordInvalidation();
             return true;
         }
 
         void clearUnlocked() noexcept
         {
-            _map.clear();
-            _strategy->onClear();
+            _strategy.onClear();
+            if (_deferDestruction || _listener || _reclaiming)
+            {
+                try
+                {
+                    reserveRetiredUnlocked(_map.size());
+                }
+                catch (...)
+                {
+                    _map.clear();
+                }
+                while (!_map.empty())
+                {
+                    retireUnlocked(_map.begin(), listener::Cause::EXPLICIT);
+                }
+            }
+            else
+            {
+                _map.clear();
+            }
+            _weight = 0;
+        }
+
+        // Once the map and the strategy have freed all their storage the arena hands its
+        // chunks back to the upstream resource in one go; the containers are then sized again.
+        void releaseArenaUnlocked() noexcept
+        {
+            memory::release(_map);
+            if constexpr (requires { _strategy.release(); })
+            {
+                _strategy.release();
+            }
+            (void) _arena->release();
+            _strategySized = false;
+            try
+            {
+                if constexpr (_unitWeight)
+                {
+                    _map.reserve(_capacity);
+                    _strategy.reserve(_capacity);
+                }
+            }
+            catch (...)
+            {
+                // Sizing is only an optimization: the containers grow on demand.
+            }
         }
 
-        MapType                                 _map;
-        mutable Mutex                           _mtx;
-        std::size_t                             _capacity;
-        std::unique_ptr<Strategy>               _strategy;
-        std::function<bool(const K&, const V&)> _invalidateCallback = nullptr;
+        static constexpr std::size_t _evictionBatch = 64;
+        static constexpr bool        _unitWeight    = weigher::isUnit<Weigher>;
+
+        // Destroying entries outside the lock only pays off for keys or values with a
+        // destructor; allocator-aware ones stay put unless reported, their memory belongs to
+        // `_memory`.
+        static constexpr bool _deferDestruction =
+            !(std::is_trivially_destructible_v<K> && std::is_trivially_destructible_v<V>) && !std::uses_allocator_v<K, std::pmr::polymorphic_allocator<K>> &&
+            !std::uses_allocator_v<V, std::pmr::polymorphic_allocator<V>> && std::is_nothrow_move_constructible_v<K> && std::is_nothrow_move_constructible_v<V>;
+
+        std::unique_ptr<memory::ReleasableResource>     _arena;
+        memory::CountingResource                        _memory;
+        MapType                                         _map{&_memory};
+        mutable Mutex                                   _mtx;
+        std::size_t                                     _capacity;
+        std::size_t                                     _weight        = 0;
+        bool                                            _strategySized = false;
+        [[no_unique_address]] Weigher                   _weigher;
+        Strategy                                        _strategy;
+        std::function<bool(const K&, const V&)>         _invalidateCallback = nullptr;
+        [[no_unique_address]] Stats                     _stats;
+        std::shared_ptr<trace::AccessTracer>            _tracer;
+        std::shared_ptr<stats::MissRatioEstimator>      _missRatio;
+        std::shared_ptr<const listener::Listener<K, V>> _listener;
+        std::vector<Removal>                            _retired;
+        bool                                            _retainRetired = false;
+        bool                                            _reclaiming    = false;
     };
 } // namespace cache
@@ -1,12 +1,25 @@
 #pragma once
 
 #include <Cache/Interfaces/IStrategyCache.hpp>
-#include <Cache/Strategy/Interfaces/ICacheStrategy.hpp>
+#include <concepts>
+#include <cstddef>
+#include <optional>
+#include <string_view>
 
 namespace cache::concepts
 {
+    // A strategy may keep a reference to the key passed to onInsert() until onRemove() or
+    // onClear() drops it (see keys::Handle); caches pass the key they store.
     template <typename S, typename K, typename V>
-    concept StrategyLike = std::is_base_of_v<cache::strategy::ICacheStrategy<typename S::KeyType, typename S::ValType>, S>;
+    concept StrategyLike = std::default_initializable<S> && requires(S& s, const typename S::KeyType& key, std::size_t cap) {
+        typename S::ValType;
+        { s.onClear() } noexcept;
+        { s.onAccess(key) } -> std::convertible_to<bool>;
+        { s.onInsert(key) } -> std::convertible_to<bool>;
+        { s.onRemove(key) } -> std::convertible_to<bool>;
+        { s.reserve(cap) };
+        { s.selectForEviction() } -> std::same_as<std::optional<typename S::KeyType>>;
+    };
 
     template <typename C, typename K, typename V>
     concept CacheLike = std::is_base_of_v<cache::IStrategyCache<typename C::KeyType, typename C::ValType>, C>;
@@ -20,4 +33,10 @@ namespace cache::concepts
     concept SharedCacheLike = CacheLike<C, K, V> && requires {
         typename C::IsSharedCache;
     };
+
+    template <typename T>
+    concept MethodTagLike = requires {
+        { T::className } -> std::convertible_to<std::string_view>;
+        { T::methodName } -> std::convertible_to<std::string_view>;
+    };
 } // namespace cache::concepts
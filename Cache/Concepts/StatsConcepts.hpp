@@ -0,0 +1,24 @@
+#pragma once
+
+#include <Cache/Stats/CacheStats.hpp>
+#include <chrono>
+#include <concepts>
+
+namespace cache::concepts
+{
+    template <typename S>
+    concept StatsLike = std::default_initializable<S> && requires(S& s, const S& cs, std::chrono::nanoseconds elapsed) {
+        { S::enabled } -> std::convertible_to<bool>;
+        { S::timed } -> std::convertible_to<bool>;
+        { s.recordHit() } noexcept;
+        { s.recordMiss() } noexcept;
+        { s.recordPut() } noexcept;
+        { s.recordEviction() } noexcept;
+        { s.recordInvalidation() } noexcept;
+        { s.recordLoadSuccess(elapsed) } noexcept;
+        { s.recordLoadFailure(elapsed) } noexcept;
+        { s.recordLatency(stats::Op::GET, elapsed) } noexcept;
+        { s.recordLockWait(elapsed) } noexcept;
+        { cs.snapshot() } -> std::same_as<stats::Snapshot>;
+    };
+} // namespace cache::concepts
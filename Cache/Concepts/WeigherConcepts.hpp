@@ -0,0 +1,13 @@
+#pragma once
+
+#include <Cache/Weigher/Weighers.hpp>
+#include <concepts>
+#include <cstddef>
+
+namespace cache::concepts
+{
+    template <typename W, typename K, typename V>
+    concept WeigherLike = std::default_initializable<W> && requires(const W& w, const K& key, const V& value) {
+        { w(key, value) } -> std::convertible_to<std::size_t>;
+    };
+} // namespace cache::concepts
@@ -2,31 +2,54 @@
 
 #include <Cache/Base.hpp>
 #include <Cache/Concepts/CacheConcepts.hpp>
+#include <Cache/Concepts/StatsConcepts.hpp>
+#include <Cache/Concepts/WeigherConcepts.hpp>
 #include <Cache/Helpers/MutexLocks.hpp>
 #include <Cache/Interfaces/AStrategyCache.hpp>
+#include <Cache/Listener/RemovalListener.hpp>
+#include <Cache/Memory/Arena.hpp>
+#include <Cache/Stats/CacheStats.hpp>
+#include <Cache/Stats/MissRatioEstimator.hpp>
 #include <Cache/Strategy/LRU.hpp>
+#include <Cache/Trace/AccessTracer.hpp>
+#include <Cache/Weigher/Weighers.hpp>
 #include <algorithm>
+#include <concepts>
 #include <cstddef>
 #include <functional>
+#include <memory>
+#include <memory_resource>
 #include <shared_mutex>
 #include <stdexcept>
+#include <utility>
 #include <vector>
 
 namespace cache
 {
 
     template <typename K, typename V, typename Strategy = strategy::LRU<K, V>, typename Hash = std::hash<K>, typename Eq = std::equal_to<K>,
-              typename Mutex = std::shared_mutex, typename InnerMutex = std::shared_mutex>
+              typename Mutex = std::shared_mutex, typename InnerMutex = std::shared_mutex, typename Stats = stats::NoStats,
+              typename Weigher = weigher::Unit>
 
-        requires concepts::StrategyLike<Strategy, K, V> && concepts::MutexLike<Mutex> && concepts::MutexLike<InnerMutex>
+        requires concepts::StrategyLike<Strategy, K, V> && concepts::MutexLike<Mutex> && concepts::MutexLike<InnerMutex> && concepts::StatsLike<Stats> &&
+                 concepts::WeigherLike<Weigher, K, V>
 
     class Fragmented final : public AStrategyCache<K, V>
     {
       public:
         using IsFragmentedCache = void;
+        using Removal           = listener::Removal<K, V>;
 
-        explicit Fragmented(std::size_t fragments = 4, std::size_t cap = 128)
-            : _nfragments(fragments), _capacity(cap), _capacity_per_fragment(std::max<std::size_t>(1, cap / std::max<std::size_t>(1, fragments)))
+        // With ARENA or SLAB every fragment owns its resource, so fragments never share a pool.
+        explicit Fragmented(std::size_t fragments = 4, std::size_t cap = 128, std::pmr::memory_resource* upstream = std::pmr::get_default_resource(),
+                            memory::Allocation allocation = memory::Allocation::DIRECT)
+            : _nfragments(fragments),
+              _capacity(cap),
+              _capacity_per_fragment(std::max<std::size_t>(1, cap / std::max<std::size_t>(1, fragments))),
+              _upstream(upstream),
+              _allocation(allocation),
+              _caches(upstream),
+              _coldStats(makeColdStats(fragments))
         {
             if (_nfragments == 0)
             {
@@ -34,7 +57,7 @@ namespace cache
             }
             if (_capacity == 0)
             {
-                throw std::invalid_argument("Cannot set a null capacity");
+                throw(std::invalid_argument("Cannot set a null capacity"));
             }
             _caches.reserve(_nfragments);
 
@@ -56,6 +79,18 @@ namespace cache
                 mutex_locks::ReadLock<decltype(_mtx)> rlock(_mtx);
                 if (!slot)
                 {
+                    if constexpr (Stats::enabled)
+                    {
+                        _coldStats[idx].recordMiss();
+                    }
+                    if (_missRatio) [[unlikely]]
+                    {
+                        _missRatio->access(Hash{}(key));
+                    }
+                    if (_tracer) [[unlikely]]
+                    {
+                        _tracer->record(trace::Op::GET, Hash{}(key), 0, false);
+                    }
                     return false;
                 }
                 local = slot.get();
@@ -65,22 +100,20 @@ namespace cache
 
         virtual void put(const K& key, const V& value) override
         {
-            Fragment* fragmentPtr = nullptr;
-            {
-                auto                                   idx = getCacheIndex(key);
-                mutex_locks::WriteLock<decltype(_mtx)> wlock(_mtx);
-                auto&                                  slot = _caches[idx];
-                if (!slot)
-                {
-                    slot = std::make_unique<Fragment>(_capacity_per_fragment);
-                    if (_invalidateCallback)
-                    {
-                        slot->invalidateIf(_invalidateCallback);
-                    }
-                }
-                fragmentPtr = slot.get();
-            }
-            fragmentPtr->put(key, value);
+            acquireFragment(key)->put(key, value);
+        }
+
+        // See Base::putReclaim().
+        bool putReclaim(const K& key, V&& value, std::vector<Removal>& reclaimed)
+        {
+            return acquireFragment(key)->putReclaim(key, std::move(value), reclaimed);
+        }
+
+        template <typename Reclaim>
+            requires std::invocable<Reclaim&, Removal&&>
+        bool putReclaim(const K& key, V&& value, Reclaim&& reclaim)
+        {
+            return acquireFragment(key)->putReclaim(key, std::move(value), std::forward<Reclaim>(reclaim));
         }
 
         virtual void remove(const K& key) override
@@ -121,6 +154,27 @@ namespace cache
             }
         }
 
+        virtual void setRemovalListener(listener::Listener<K, V> listener) override
+        {
+            std::vector<Fragment*> fragments;
+            {
+                mutex_locks::WriteLock<decltype(_mtx)> wlock(_mtx);
+                _listener = listener;
+                fragments.reserve(_caches.size());
+                for (auto& up : _caches)
+                {
+                    if (up)
+                    {
+                        fragments.push_back(up.get());
+                    }
+                }
+            }
+            for (auto* f : fragments)
+            {
+                f->setRemovalListener(listener);
+            }
+        }
+
         [[nodiscard]] virtual bool hasInvalidationPredicate() const noexcept override
         {
             mutex_locks::ReadLock<decltype(_mtx)> rlock(_mtx);
@@ -150,14 +204,28 @@ namespace cache
 
         virtual void clear() noexcept override
         {
-            mutex_locks::WriteLock<decltype(_mtx)> wlock(_mtx);
-            for (auto& cache : _caches)
+            // Fragments are cleared outside the wrapper lock so that removal listeners never
+            // run under it.
+            std::vector<Fragment*> fragments;
+            try
             {
-                if (cache)
+                mutex_locks::WriteLock<decltype(_mtx)> wlock(_mtx);
+                fragments.reserve(_caches.size());
+                for (auto& up : _caches)
                 {
-                    cache->clear();
+                    if (up)
+                    {
+                        fragments.push_back(up.get());
+                    }
                 }
             }
+            catch (...)
+            {
+            }
+            for (auto* f : fragments)
+            {
+                f->clear();
+            }
         }
 
         [[nodiscard]] virtual std::size_t size() const noexcept override
@@ -182,11 +250,166 @@ namespace cache
             return res;
         }
 
+        // Total weight across fragments; equals size() with the default Weigher.
+        [[nodiscard]] std::size_t weight() const noexcept
+        {
+            std::vector<Fragment*> fragments;
+            {
+                mutex_locks::ReadLock<decltype(_mtx)> rlock(_mtx);
+                fragments.reserve(_caches.size());
+                for (auto& up : _caches)
+                {
+                    if (up)
+                    {
+                        fragments.push_back(up.get());
+                    }
+                }
+            }
+            std::size_t res = 0;
+            for (auto* f : fragments)
+            {
+                res += f->weight();
+            }
+            return res;
+        }
+
         [[nodiscard]] virtual std::size_t capacity() const noexcept override
         {
+            mutex_locks::ReadLock<decltype(_mtx)> rlock(_mtx);
             return _capacity;
         }
 
+        // Splits the new capacity evenly; each existing fragment trims its own excess incrementally.
+        virtual void setCapacity(std::size_t cap) override
+        {
+            if (cap == 0)
+            {
+                throw(std::invalid_argument("Cannot set a null capacity"));
+            }
+            std::vector<Fragment*> fragments;
+            std::size_t            perFragment = 0;
+            {
+                mutex_locks::WriteLock<decltype(_mtx)> wlock(_mtx);
+                _capacity              = cap;
+                _capacity_per_fragment = std::max<std::size_t>(1, cap / _nfragments);
+                perFragment            = _capacity_per_fragment;
+                fragments.reserve(_caches.size());
+                for (auto& up : _caches)
+                {
+                    if (up)
+                    {
+                        fragments.push_back(up.get());
+                    }
+                }
+            }
+            for (auto* f : fragments)
+            {
+                f->setCapacity(perFragment);
+            }
+        }
+
+        [[nodiscard]] virtual stats::Snapshot stats() const noexcept override
+        {
+            std::vector<Fragment*> fragments;
+            {
+                mutex_locks::ReadLock<decltype(_mtx)> rlock(_mtx);
+                fragments.reserve(_caches.size());
+                for (auto& up : _caches)
+                {
+                    if (up)
+                    {
+                        fragments.push_back(up.get());
+                    }
+                }
+            }
+            stats::Snapshot res;
+            for (std::size_t i = 0; i < _nfragments; ++i)
+            {
+                res += coldSnapshot(i);
+            }
+            for (auto* f : fragments)
+            {
+                res += f->stats();
+            }
+            return res;
+        }
+
+        [[nodiscard]] virtual memory::Usage memoryUsage() const override
+        {
+            std::vector<Fragment*> fragments;
+            memory::Usage          res;
+            {
+                mutex_locks::ReadLock<decltype(_mtx)> rlock(_mtx);
+                res.overheadBytes = sizeof(*this) + _caches.capacity() * sizeof(typename decltype(_caches)::value_type);
+                fragments.reserve(_caches.size());
+                for (auto& up : _caches)
+                {
+                    if (up)
+                    {
+                        fragments.push_back(up.get());
+                    }
+                }
+            }
+            for (auto* f : fragments)
+            {
+                res += f->memoryUsage();
+            }
+            return res;
+        }
+
+        // Attaches (or detaches) an access tracer on every fragment, including ones created later.
+        void setTracer(std::shared_ptr<trace::AccessTracer> tracer)
+        {
+            mutex_locks::WriteLock<decltype(_mtx)> wlock(_mtx);
+            _tracer = std::move(tracer);
+            for (auto& up : _caches)
+            {
+                if (up)
+                {
+                    up->setTracer(_tracer);
+                }
+            }
+        }
+
+        // Shares one miss ratio estimator between all fragments, so the curve describes the whole cache.
+        void setMissRatioEstimator(std::shared_ptr<stats::MissRatioEstimator> estimator)
+        {
+            mutex_locks::WriteLock<decltype(_mtx)> wlock(_mtx);
+            _missRatio = std::move(estimator);
+            for (auto& up : _caches)
+            {
+                if (up)
+                {
+                    up->setMissRatioEstimator(_missRatio);
+                }
+            }
+        }
+
+        // Per-fragment breakdown in index order, including the misses a fragment answered before
+        // it was created.
+        [[nodiscard]] std::vector<stats::Snapshot> fragmentStats() const noexcept
+        {
+            std::vector<Fragment*> fragments;
+            {
+                mutex_locks::ReadLock<decltype(_mtx)> rlock(_mtx);
+                fragments.reserve(_caches.size());
+                for (auto& up : _caches)
+                {
+                    fragments.push_back(up.get());
+                }
+            }
+            std::vector<stats::Snapshot> res(fragments.size());
+            for (std::size_t i = 0; i < fragments.size(); ++i)
+            {
+                res[i] = coldSnapshot(i);
+                if (fragments[i])
+                {
+                    res[i] += fragments[i]->stats();
+                }
+            }
+            return res;
+        }
+
         [[nodiscard]] virtual bool isMtSafe() const noexcept override
         {
             if constexpr (std::is_same_v<Mutex, mutex_locks::NoLock>)
@@ -198,7 +421,7 @@ namespace cache
 
       protected:
         using PutRequirement = typename AStrategyCache<K, V>::PutRequirement;
-        using Fragment       = Base<K, V, Strategy, Hash, Eq, InnerMutex>;
+        using Fragment       = Base<K, V, Strategy, Hash, Eq, InnerMutex, Stats, Weigher>;
 
         [[nodiscard]] bool putConditional(const K& key, const V& value, PutRequirement req) override
         {
@@ -211,11 +434,7 @@ namespace cache
                 auto&                                  slot = _caches[idx];
                 if (!slot)
                 {
-                    slot = std::make_unique<Fragment>(_capacity_per_fragment);
-                    if (_invalidateCallback)
-                    {
-                        slot->invalidateIf(_invalidateCallback);
-                    }
+                    createFragmentUnlocked(slot);
                 }
                 fragment = slot.get();
             }
@@ -253,16 +472,82 @@ namespace cache
         }
 
       private:
-        mutable Mutex                           _mtx;
-        const std::size_t                       _nfragments;
-        const std::size_t                       _capacity;
-        const std::size_t                       _capacity_per_fragment;
-        std::vector<std::unique_ptr<Fragment>>  _caches;
-        std::function<bool(const K&, const V&)> _invalidateCallback = nullptr;
+        mutable Mutex                               _mtx;
+        const std::size_t                           _nfragments;
+        std::size_t                                 _capacity;
+        std::size_t                                 _capacity_per_fragment;
+        std::pmr::memory_resource*                  _upstream;
+        memory::Allocation                          _allocation;
+        std::pmr::vector<std::unique_ptr<Fragment>> _caches;
+        std::function<bool(const K&, const V&)>     _invalidateCallback = nullptr;
+        std::shared_ptr<trace::AccessTracer>        _tracer;
+        std::shared_ptr<stats::MissRatioEstimator>  _missRatio;
+        listener::Listener<K, V>                    _listener;
+        // Misses on keys whose fragment does not exist yet, per fragment; null when Stats
+        // records nothing.
+        std::unique_ptr<Stats[]>                    _coldStats;
+
+        [[nodiscard]] static std::unique_ptr<Stats[]> makeColdStats(std::size_t fragments)
+        {
+            if constexpr (Stats::enabled)
+            {
+                return std::make_unique<Stats[]>(fragments);
+            }
+            else
+            {
+                return nullptr;
+            }
+        }
+
+        [[nodiscard]] stats::Snapshot coldSnapshot(std::size_t idx) const noexcept
+        {
+            if constexpr (Stats::enabled)
+            {
+                return _coldStats[idx].snapshot();
+            }
+            else
+            {
+                return {};
+            }
+        }
+
+        void createFragmentUnlocked(std::unique_ptr<Fragment>& slot)
+        {
+            slot = std::make_unique<Fragment>(_capacity_per_fragment, _upstream, _allocation);
+            if (_invalidateCallback)
+            {
+                slot->invalidateIf(_invalidateCallback);
+            }
+            if (_tracer)
+            {
+                slot->setTracer(_tracer);
+            }
+            if (_missRatio)
+            {
+                slot->setMissRatioEstimator(_missRatio);
+            }
+            if (_listener)
+            {
+                slot->setRemovalListener(_listener);
+            }
+        }
+
+        // Fragment holding `key`, created on first use.
+        Fragment* acquireFragment(const K& key)
+        {
+            auto                                   idx = getCacheIndex(key);
+            mutex_locks::WriteLock<decltype(_mtx)> wlock(_mtx);
+            auto&                                  slot = _caches[idx];
+            if (!slot)
+            {
+                createFragmentUnlocked(slot);
+            }
+            return slot.get();
+        }
 
         std::size_t getCacheIndex(const K& key) const noexcept
         {
-            return std::hash<K>{}(key) % _nfragments;
+            return Hash{}(key) % _nfragments;
         }
 
         std::unique_ptr<Fragment>& getFragmentSlot(std::size_t idx) const
@@ -0,0 +1,89 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <functional>
+#include <type_traits>
+
+namespace cache::hashing
+{
+    inline constexpr std::uint64_t seed    = 0xa0761d6478bd642full;
+    inline constexpr std::uint64_t secret1 = 0xe7037ed1a0b428dbull;
+    inline constexpr std::uint64_t secret2 = 0x8ebc6af09c88c6e3ull;
+    inline constexpr std::uint64_t secret3 = 0x589965cc75374cc3ull;
+
+    // 64x64 -> 128 bit multiply folded back to 64 bits (wyhash "mum").
+    [[nodiscard]] inline std::uint64_t mum(std::uint64_t a, std::uint64_t b) noexcept
+    {
+#if defined(__SIZEOF_INT128__)
+        const unsigned __int128 r = static_cast<unsigned __int128>(a) * b;
+        return static_cast<std::uint64_t>(r) ^ static_cast<std::uint64_t>(r >> 64);
+#else
+        const std::uint64_t ha = a >> 32, la = a & 0xffffffffull;
+        const std::uint64_t hb = b >> 32, lb = b & 0xffffffffull;
+        const std::uint64_t hh = ha * hb, hl = ha * lb, lh = la * hb, ll = la * lb;
+        const std::uint64_t mid = (ll >> 32) + (hl & 0xffffffffull) + (lh & 0xffffffffull);
+        const std::uint64_t lo  = (mid << 32) | (ll & 0xffffffffull);
+        const std::uint64_t hi  = hh + (hl >> 32) + (lh >> 32) + (mid >> 32);
+        return lo ^ hi;
+#endif
+    }
+
+    [[nodiscard]] inline std::uint64_t mix(std::uint64_t state, std::uint64_t word) noexcept
+    {
+        return mum(word ^ secret1, state ^ secret2);
+    }
+
+    [[nodiscard]] inline std::uint64_t finalize(std::uint64_t state, std::uint64_t length) noexcept
+    {
+        return mum(state ^ length, secret3);
+    }
+
+    [[nodiscard]] inline std::uint64_t hashBytes(const void* data, std::size_t len, std::uint64_t state = seed) noexcept
+    {
+        const auto* p = static_cast<const unsigned char*>(data);
+        std::size_t i = 0;
+        for (; i + 8 <= len; i += 8)
+        {
+            std::uint64_t word;
+            std::memcpy(&word, p + i, 8);
+            state = mix(state, word);
+        }
+        if (i < len)
+        {
+            std::uint64_t word = 0;
+            std::memcpy(&word, p + i, len - i);
+            state = mix(state, word);
+        }
+        return finalize(state, len);
+    }
+
+    // Folds one value into `state`. Floating point values are normalized so that
+    // -0.0 and 0.0, which compare equal, also hash equal.
+    template <typename T>
+    [[nodiscard]] std::uint64_t combine(std::uint64_t state, const T& value) noexcept
+    {
+        if constexpr (std::is_floating_point_v<T> && sizeof(T) <= sizeof(std::uint64_t))
+        {
+            const T       normalized = value == T(0) ? T(0) : value;
+            std::uint64_t word       = 0;
+            std::memcpy(&word, &normalized, sizeof(T));
+            return mix(state, word);
+        }
+        else if constexpr (std::has_unique_object_representations_v<T> && sizeof(T) <= sizeof(std::uint64_t))
+        {
+            std::uint64_t word = 0;
+            std::memcpy(&word, &value, sizeof(T));
+            return mix(state, word);
+        }
+        else if constexpr (std::has_unique_object_representations_v<T>)
+        {
+            return mix(state, hashBytes(&value, sizeof(T)));
+        }
+        else
+        {
+            return mix(state, static_cast<std::uint64_t>(std::hash<T>{}(value)));
+        }
+    }
+} // namespace cache::hashing
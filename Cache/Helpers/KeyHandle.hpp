@@ -0,0 +1,92 @@
+#pragma once
+
+#include <cstddef>
+#include <functional>
+#include <type_traits>
+
+namespace cache::keys
+{
+    // Strategies index entries by key. Keys that are cheap to copy are stored by value; any
+    // other key is borrowed: the strategy keeps a pointer to the key passed to onInsert(),
+    // which must stay alive until onRemove() or onClear() drops it. Base satisfies this by
+    // passing the key stored in its map node and detaching it from the strategy before the
+    // node is erased.
+    template <typename K>
+    inline constexpr bool borrowed = !(std::is_trivially_copyable_v<K> && sizeof(K) <= sizeof(void*));
+
+    template <typename K>
+    using Handle = std::conditional_t<borrowed<K>, const K*, K>;
+
+    template <typename K>
+    [[nodiscard]] constexpr Handle<K> handle(const K& key) noexcept
+    {
+        if constexpr (borrowed<K>)
+        {
+            return &key;
+        }
+        else
+        {
+            return key;
+        }
+    }
+
+    template <typename K>
+    [[nodiscard]] constexpr const K& get(const Handle<K>& h) noexcept
+    {
+        if constexpr (borrowed<K>)
+        {
+            return *h;
+        }
+        else
+        {
+            return h;
+        }
+    }
+
+    // Hash and equality for strategy indexes keyed by Handle<K>; borrowed handles are
+    // transparent so the indexes can be searched with a plain key.
+    template <typename K, bool = borrowed<K>>
+    struct Hash : std::hash<K>
+    { };
+
+    template <typename K>
+    struct Hash<K, true>
+    {
+        using is_transparent = void;
+
+        [[nodiscard]] std::size_t operator()(const K& key) const noexcept(noexcept(std::hash<K>{}(key)))
+        {
+            return std::hash<K>{}(key);
+        }
+
+        [[nodiscard]] std::size_t operator()(const K* key) const noexcept(noexcept(std::hash<K>{}(*key)))
+        {
+            return std::hash<K>{}(*key);
+        }
+    };
+
+    template <typename K, bool = borrowed<K>>
+    struct Eq : std::equal_to<K>
+    { };
+
+    template <typename K>
+    struct Eq<K, true>
+    {
+        using is_transparent = void;
+
+        [[nodiscard]] bool operator()(const K* lhs, const K* rhs) const
+        {
+            return *lhs == *rhs;
+        }
+
+        [[nodiscard]] bool operator()(const K& lhs, const K* rhs) const
+        {
+            return lhs == *rhs;
+        }
+
+        [[nodiscard]] bool operator()(const K* lhs, const K& rhs) const
+        {
+            return *lhs == rhs;
+        }
+    };
+} // namespace cache::keys
@@ -13,16 +13,20 @@ namespace cache
 
         virtual ~AStrategyCache() noexcept = default;
 
-        [[nodiscard]] virtual bool        get(const K& key, V& cacheOut)                                  = 0;
-        virtual void                      put(const K& key, const V& value)                               = 0;
-        virtual void                      remove(const K& key)                                            = 0;
-        virtual void                      invalidateIf(std::function<bool(const K&, const V&)> predicate) = 0;
-        [[nodiscard]] virtual bool        hasInvalidationPredicate() const noexcept                       = 0;
-        virtual void                      clearInvalidationPredicate()                                    = 0;
-        virtual void                      clear() noexcept                                                = 0;
-        [[nodiscard]] virtual std::size_t size() const noexcept                                           = 0;
-        [[nodiscard]] virtual std::size_t capacity() const noexcept                                       = 0;
-        [[nodiscard]] virtual bool        isMtSafe() const noexcept                                       = 0;
+        [[nodiscard]] virtual bool            get(const K& key, V& cacheOut)                                  = 0;
+        virtual void                          put(const K& key, const V& value)                               = 0;
+        virtual void                          remove(const K& key)                                            = 0;
+        virtual void                          invalidateIf(std::function<bool(const K&, const V&)> predicate) = 0;
+        [[nodiscard]] virtual bool            hasInvalidationPredicate() const noexcept                       = 0;
+        virtual void                          clearInvalidationPredicate()                                    = 0;
+        virtual void                          clear() noexcept                                                = 0;
+        [[nodiscard]] virtual std::size_t     size() const noexcept                                           = 0;
+        [[nodiscard]] virtual std::size_t     capacity() const noexcept                                       = 0;
+        virtual void                          setCapacity(std::size_t cap)                                    = 0;
+        virtual void                          setRemovalListener(listener::Listener<K, V> listener)           = 0;
+        [[nodiscard]] virtual bool            isMtSafe() const noexcept                                       = 0;
+        [[nodiscard]] virtual stats::Snapshot stats() const noexcept                                          = 0;
+        [[nodiscard]] virtual memory::Usage   memoryUsage() const                                             = 0;
 
         [[nodiscard]] bool contains(const K& key, bool countAsAccess = false) final override
         {
@@ -0,0 +1,258 @@
+#pragma once
+
+#include <Cache/Utils/NonCopyable.hpp>
+#include <algorithm>
+#include <array>
+#include <condition_variable>
+#include <cstddef>
+#include <cstdint>
+#include <deque>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <optional>
+#include <thread>
+#include <utility>
+#include <vector>
+
+namespace cache::listener
+{
+    enum class Cause : std::uint8_t
+    {
+        SIZE,        // evicted to respect the capacity
+        EXPIRED,     // reserved for time-based expiry
+        EXPLICIT,    // remove() or clear()
+        REPLACED,    // overwritten by a put(); the old value is reported
+        INVALIDATED, // matched the invalidation predicate
+    };
+
+    template <typename K, typename V>
+    struct Removal
+    {
+        K     key;
+        V     value;
+        Cause cause;
+    };
+
+    // Receives each removed entry by rvalue, so buffers can be moved out and recycled.
+    template <typename K, typename V>
+    using Listener = std::function<void(Removal<K, V>&&)>;
+
+    // Entries a cache dropped under its lock. They are reported to the listener, then
+    // destroyed, when this goes out of scope once the lock has been released. The first few
+    // are held inline, so that retiring them allocates nothing under the lock.
+    template <typename K, typename V>
+    class Retired : public utils::NonCopyable
+    {
+      public:
+        Retired() = default;
+
+        ~Retired() noexcept
+        {
+            if (!_listener)
+            {
+                return;
+            }
+            for (std::size_t i = 0; i < _inlineCount; ++i)
+            {
+                report(std::move(*_inline[i]));
+            }
+            for (auto& removal : _overflow)
+            {
+                report(std::move(removal));
+            }
+        }
+
+        // Moves the elements of `entries` out, leaving it empty with its capacity, along with
+        // the listener to report them to.
+        void take(std::vector<Removal<K, V>>& entries, const std::shared_ptr<const Listener<K, V>>& listener) noexcept
+        {
+            if (entries.empty())
+            {
+                return;
+            }
+            try
+            {
+                for (auto& removal : entries)
+                {
+                    if (_inlineCount < _inline.size())
+                    {
+                        _inline[_inlineCount].emplace(std::move(removal));
+                        ++_inlineCount;
+                    }
+                    else
+                    {
+                        _overflow.push_back(std::move(removal));
+                    }
+                }
+            }
+            catch (...)
+            {
+            }
+            entries.clear();
+            if (listener)
+            {
+                _listener = listener;
+            }
+        }
+
+      private:
+        void report(Removal<K, V>&& removal) noexcept
+        {
+            try
+            {
+                (*_listener)(std::move(removal));
+            }
+            catch (...)
+            {
+                // A failing listener must not take the cache down with it.
+            }
+        }
+
+        std::array<std::optional<Removal<K, V>>, 4> _inline;
+        std::size_t                                 _inlineCount = 0;
+        std::vector<Removal<K, V>>                  _overflow;
+        std::shared_ptr<const Listener<K, V>>       _listener;
+    };
+
+    enum class Overflow
+    {
+        BLOCK, // the removing thread waits for room, outside the cache lock
+        DROP   // the removal is counted in dropped() and discarded
+    };
+
+    // Listener that queues removals for a worker thread, so a slow listener never delays the
+    // cache's callers. Copies share the queue and the worker; the last one to go drains the
+    // queue and joins the worker.
+    template <typename K, typename V>
+    class AsyncListener
+    {
+      public:
+        explicit AsyncListener(Listener<K, V> listener, std::size_t capacity = 1024, Overflow overflow = Overflow::BLOCK)
+            : _state(std::make_shared<State>(std::move(listener), std::max<std::size_t>(1, capacity), overflow))
+        {
+            _state->start();
+        }
+
+        void operator()(Removal<K, V>&& removal) const
+        {
+            _state->push(std::move(removal));
+        }
+
+        // Waits until every queued removal has been delivered.
+        void flush() const
+        {
+            _state->flush();
+        }
+
+        [[nodiscard]] std::uint64_t delivered() const noexcept
+        {
+            std::lock_guard<std::mutex> lock(_state->mtx);
+            return _state->delivered;
+        }
+
+        [[nodiscard]] std::uint64_t dropped() const noexcept
+        {
+            std::lock_guard<std::mutex> lock(_state->mtx);
+            return _state->dropped;
+        }
+
+      private:
+        struct State : public utils::NonCopyable
+        {
+            State(Listener<K, V> fn, std::size_t cap, Overflow policy) : listener(std::move(fn)), capacity(cap), overflow(policy)
+            { }
+
+            ~State() noexcept
+            {
+                {
+                    std::lock_guard<std::mutex> lock(mtx);
+                    stopped = true;
+                }
+                notEmpty.notify_all();
+                if (worker.joinable())
+                {
+                    worker.join();
+                }
+            }
+
+            void start()
+            {
+                worker = std::thread([this] { run(); });
+            }
+
+            void push(Removal<K, V>&& removal)
+            {
+                std::unique_lock<std::mutex> lock(mtx);
+                if (queue.size() >= capacity)
+                {
+                    if (overflow == Overflow::DROP)
+                    {
+                        ++dropped;
+                        return;
+                    }
+                    notFull.wait(lock, [this] { return queue.size() < capacity || stopped; });
+                }
+                queue.push_back(std::move(removal));
+                lock.unlock();
+                notEmpty.notify_one();
+            }
+
+            void flush()
+            {
+                std::unique_lock<std::mutex> lock(mtx);
+                idle.wait(lock, [this] { return queue.empty() && !busy; });
+            }
+
+            void run()
+            {
+                std::deque<Removal<K, V>>    batch;
+                std::unique_lock<std::mutex> lock(mtx);
+                while (true)
+                {
+                    notEmpty.wait(lock, [this] { return !queue.empty() || stopped; });
+                    if (queue.empty())
+                    {
+                        return;
+                    }
+                    batch.swap(queue);
+                    busy = true;
+                    lock.unlock();
+                    notFull.notify_all();
+                    for (auto& removal : batch)
+                    {
+                        try
+                        {
+                            listener(std::move(removal));
+                        }
+                        catch (...)
+                        {
+                        }
+                    }
+                    const std::size_t n = batch.size();
+                    batch.clear();
+                    lock.lock();
+                    busy = false;
+                    delivered += n;
+                    idle.notify_all();
+                }
+            }
+
+            Listener<K, V>            listener;
+            const std::size_t         capacity;
+            const Overflow            overflow;
+            std::mutex                mtx;
+            std::condition_variable   notEmpty;
+            std::condition_variable   notFull;
+            std::condition_variable   idle;
+            std::deque<Removal<K, V>> queue;
+            bool                      busy      = false;
+            bool                      stopped   = false;
+            std::uint64_t             delivered = 0;
+            std::uint64_t             dropped   = 0;
+            std::thread               worker;
+        };
+
+        std::shared_ptr<State> _state;
+    };
+} // namespace cache::listener
@@ -0,0 +1,105 @@
+#pragma once
+
+#include <Cache/Utils/NonCopyable.hpp>
+#include <algorithm>
+#include <cstddef>
+#include <memory_resource>
+
+namespace cache::memory
+{
+    // Where a cache takes its memory from. DIRECT allocates every node from the upstream
+    // resource; ARENA gives the cache its own Arena on top of it and SLAB its own
+    // SlabResource (see SlabResource.hpp).
+    enum class Allocation
+    {
+        DIRECT,
+        ARENA,
+        SLAB
+    };
+
+    // A resource owned by one cache that can give all its memory back upstream at once,
+    // provided nothing allocated from it is still alive.
+    class ReleasableResource : public std::pmr::memory_resource, public utils::NonCopyable
+    {
+      public:
+        // Blocks handed out and not yet deallocated.
+        [[nodiscard]] virtual std::size_t liveBlocks() const noexcept = 0;
+
+        // Returns all memory to the upstream resource; refused while any block is still live.
+        virtual bool release() noexcept = 0;
+    };
+
+    // Per-cache pool over an upstream resource (the default heap, a huge-page resource, ...):
+    // freed nodes are recycled from size-class free lists instead of going back upstream, and
+    // release() hands every chunk back at once. Not synchronized: each cache (or fragment)
+    // owns one and only allocates from it under its own lock.
+    class Arena final : public ReleasableResource
+    {
+      public:
+        explicit Arena(std::pmr::memory_resource* upstream = std::pmr::get_default_resource()) : _pool(std::pmr::pool_options{}, upstream)
+        { }
+
+        [[nodiscard]] std::size_t liveBlocks() const noexcept override
+        {
+            return _live;
+        }
+
+        [[nodiscard]] std::pmr::memory_resource* upstream() const noexcept
+        {
+            return _pool.upstream_resource();
+        }
+
+        bool release() noexcept override
+        {
+            if (_live != 0)
+            {
+                return false;
+            }
+            _pool.release();
+            return true;
+        }
+
+      private:
+        void* do_allocate(std::size_t bytes, std::size_t alignment) override
+        {
+            void* p = _pool.allocate(bytes, alignment);
+            ++_live;
+            return p;
+        }
+
+        void do_deallocate(void* p, std::size_t bytes, std::size_t alignment) override
+        {
+            _pool.deallocate(p, bytes, alignment);
+            --_live;
+        }
+
+        [[nodiscard]] bool do_is_equal(const std::pmr::memory_resource& other) const noexcept override
+        {
+            return this == &other;
+        }
+
+        std::pmr::unsynchronized_pool_resource _pool;
+        std::size_t                            _live = 0;
+    };
+
+    // Empties a pmr container and frees its storage too (buckets, vector capacity), which
+    // clear() keeps.
+    template <typename Container>
+    void release(Container& c) noexcept
+    {
+        Container(c.get_allocator()).swap(c);
+    }
+
+    // Rehashes an unordered container down to `entries` once it has more than four times the
+    // buckets they need. A rehash relinks every node while the caller holds its lock, so
+    // smaller slack is left alone.
+    template <typename Container>
+    void shrink(Container& c, std::size_t entries)
+    {
+        const std::size_t needed = std::max<std::size_t>({1, entries, c.size()});
+        if (static_cast<double>(c.bucket_count()) * c.max_load_factor() > 4.0 * static_cast<double>(needed))
+        {
+            c.rehash(needed);
+        }
+    }
+} // namespace cache::memory
@@ -0,0 +1,65 @@
+#pragma once
+
+#include <Cache/Utils/NonCopyable.hpp>
+#include <algorithm>
+#include <cstddef>
+#include <memory_resource>
+
+namespace cache::memory
+{
+    // Forwards to an upstream resource and keeps track of the bytes and blocks it holds.
+    // Not synchronized: the owning cache or strategy only allocates under its own lock.
+    class CountingResource final : public std::pmr::memory_resource, public utils::NonCopyable
+    {
+      public:
+        explicit CountingResource(std::pmr::memory_resource* upstream = std::pmr::get_default_resource()) noexcept : _upstream(upstream)
+        { }
+
+        [[nodiscard]] std::size_t bytes() const noexcept
+        {
+            return _bytes;
+        }
+
+        [[nodiscard]] std::size_t blocks() const noexcept
+        {
+            return _blocks;
+        }
+
+        [[nodiscard]] std::size_t peakBytes() const noexcept
+        {
+            return _peak;
+        }
+
+        [[nodiscard]] std::pmr::memory_resource* upstream() const noexcept
+        {
+            return _upstream;
+        }
+
+      private:
+        void* do_allocate(std::size_t bytes, std::size_t alignment) override
+        {
+            void* p = _upstream->allocate(bytes, alignment);
+            _bytes += bytes;
+            ++_blocks;
+            _peak = std::max(_peak, _bytes);
+            return p;
+        }
+
+        void do_deallocate(void* p, std::size_t bytes, std::size_t alignment) override
+        {
+            _upstream->deallocate(p, bytes, alignment);
+            _bytes -= bytes;
+            --_blocks;
+        }
+
+        [[nodiscard]] bool do_is_equal(const std::pmr::memory_resource& other) const noexcept override
+        {
+            return this == &other;
+        }
+
+        std::pmr::memory_resource* _upstream;
+        std::size_t                _bytes  = 0;
+        std::size_t                _blocks = 0;
+        std::size_t                _peak   = 0;
+    };
+} // namespace cache::memory
@@ -0,0 +1,63 @@
+#pragma once
+
+#include <cstddef>
+#include <functional>
+
+namespace cache::memory
+{
+    // Allocator-aware containers whose contents may live on the heap behind the object
+    // (std::string, std::vector, ...); views and fixed arrays keep theirs elsewhere or inline.
+    template <typename T>
+    concept OwnsHeap = requires(const T& value) {
+        typename T::value_type;
+        typename T::allocator_type;
+        value.capacity();
+        value.data();
+    };
+
+    // Bytes allocated by `value` outside of sizeof(T), by capacity and with the terminator of
+    // strings; 0 for types that own no heap contents and for a small-buffer `value`.
+    template <typename T>
+    [[nodiscard]] std::size_t heapBytes(const T& value) noexcept
+    {
+        if constexpr (OwnsHeap<T>)
+        {
+            const std::less<const void*> before;
+            const void*                  data = value.data();
+            if (!before(data, &value) && before(data, &value + 1))
+            {
+                return 0;
+            }
+            std::size_t elements = value.capacity();
+            if constexpr (requires { typename T::traits_type; })
+            {
+                ++elements;
+            }
+            return elements * sizeof(typename T::value_type);
+        }
+        else
+        {
+            return 0;
+        }
+    }
+
+    struct Usage
+    {
+        std::size_t payloadBytes  = 0; // keys and values, including the heap contents they own
+        std::size_t overheadBytes = 0; // nodes, buckets, strategy bookkeeping and duplicated keys
+        std::size_t allocations   = 0; // live blocks held by the internal containers
+
+        [[nodiscard]] std::size_t total() const noexcept
+        {
+            return payloadBytes + overheadBytes;
+        }
+
+        Usage& operator+=(const Usage& other) noexcept
+        {
+            payloadBytes += other.payloadBytes;
+            overheadBytes += other.overheadBytes;
+            allocations += other.allocations;
+            return *this;
+        }
+    };
+} // namespace cache::memory
@@ -0,0 +1,288 @@
+#pragma once
+
+#include <Cache/Memory/Arena.hpp>
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <memory_resource>
+#include <new>
+#include <stdexcept>
+#include <vector>
+
+namespace cache::memory
+{
+    // memcached-style slab allocator. Memory comes from the upstream resource in pages of
+    // `pageSize` bytes, aligned to their size and carved into equal chunks of one size
+    // class; class sizes grow by `growthFactor`. A freed chunk goes back to its page, and a
+    // page whose chunks are all free returns to a shared pool from which any class takes
+    // its next page. Evictions in one class thereby feed the classes that keep allocating,
+    // and the footprint follows the live chunks instead of every value size ever stored.
+    // Requests larger than the biggest class go straight upstream. Not synchronized.
+    class SlabResource final : public ReleasableResource
+    {
+      public:
+        explicit SlabResource(std::pmr::memory_resource* upstream = std::pmr::get_default_resource(), std::size_t pageSize = std::size_t(1) << 20,
+                              double growthFactor = 1.25)
+            : _upstream(upstream), _pageSize(pageSize)
+        {
+            if (pageSize < 4096 || (pageSize & (pageSize - 1)) != 0)
+            {
+                throw(std::invalid_argument("Slab page size must be a power of two of at least 4096 bytes."));
+            }
+            if (!(growthFactor > 1.0))
+            {
+                throw(std::invalid_argument("Slab growth factor must be greater than 1."));
+            }
+            const std::size_t usable = _pageSize - _headerSize;
+            for (std::size_t size = _minChunk; size <= usable / 2;)
+            {
+                _classes.push_back(SizeClass{size, usable / size});
+                const auto grown = static_cast<std::size_t>(static_cast<double>(size) * growthFactor);
+                size             = roundUp(std::max(grown, size + 1));
+            }
+        }
+
+        ~SlabResource() noexcept override
+        {
+            releasePages();
+        }
+
+        [[nodiscard]] std::size_t liveBlocks() const noexcept override
+        {
+            return _live;
+        }
+
+        bool release() noexcept override
+        {
+            if (_live != 0)
+            {
+                return false;
+            }
+            releasePages();
+            return true;
+        }
+
+        [[nodiscard]] std::pmr::memory_resource* upstream() const noexcept
+        {
+            return _upstream;
+        }
+
+        // Pages currently held from the upstream resource, in use or pooled.
+        [[nodiscard]] std::size_t pages() const noexcept
+        {
+            return _pages.size();
+        }
+
+        // Empty pages waiting in the shared pool.
+        [[nodiscard]] std::size_t freePages() const noexcept
+        {
+            return _freePages;
+        }
+
+        // Pages handed from one size class to another.
+        [[nodiscard]] std::size_t reassignments() const noexcept
+        {
+            return _reassignments;
+        }
+
+        [[nodiscard]] std::size_t pageSize() const noexcept
+        {
+            return _pageSize;
+        }
+
+        // Chunk size that serves a request of `bytes`, or 0 when it goes upstream.
+        [[nodiscard]] std::size_t chunkSize(std::size_t bytes, std::size_t alignment = alignof(std::max_align_t)) const noexcept
+        {
+            const std::size_t cls = classOf(bytes, alignment);
+            return cls == _classes.size() ? 0 : _classes[cls].size;
+        }
+
+      private:
+        struct Page
+        {
+            Page*       prev;
+            Page*       next;
+            void*       freeList;
+            std::size_t cls;
+            std::size_t used;
+            std::size_t carved;
+        };
+
+        struct SizeClass
+        {
+            std::size_t size;
+            std::size_t perPage;
+            Page*       partial = nullptr;
+        };
+
+        static constexpr std::size_t _align      = alignof(std::max_align_t);
+        static constexpr std::size_t _minChunk   = 32;
+        static constexpr std::size_t _headerSize = (sizeof(Page) + _align - 1) / _align * _align;
+
+        static constexpr std::size_t roundUp(std::size_t size) noexcept
+        {
+            return (size + _align - 1) / _align * _align;
+        }
+
+        void* do_allocate(std::size_t bytes, std::size_t alignment) override
+        {
+            const std::size_t cls = classOf(bytes, alignment);
+            if (cls == _classes.size())
+            {
+                void* p = _upstream->allocate(bytes, alignment);
+                ++_live;
+                return p;
+            }
+            SizeClass& c    = _classes[cls];
+            Page*      page = c.partial ? c.partial : acquirePage(cls);
+            void*      chunk;
+            if (page->freeList)
+            {
+                chunk          = page->freeList;
+                page->freeList = *static_cast<void**>(chunk);
+            }
+            else
+            {
+                chunk = reinterpret_cast<std::byte*>(page) + _headerSize + page->carved * c.size;
+                ++page->carved;
+            }
+            if (++page->used == c.perPage)
+            {
+                unlink(c.partial, page);
+            }
+            ++_live;
+            return chunk;
+        }
+
+        void do_deallocate(void* p, std::size_t bytes, std::size_t alignment) override
+        {
+            --_live;
+            if (classOf(bytes, alignment) == _classes.size())
+            {
+                _upstream->deallocate(p, bytes, alignment);
+                return;
+            }
+            Page*      page = pageOf(p);
+            SizeClass& c    = _classes[page->cls];
+            if (page->used == c.perPage)
+            {
+                pushFront(c.partial, page);
+            }
+            *static_cast<void**>(p) = page->freeList;
+            page->freeList          = p;
+            if (--page->used == 0)
+            {
+                unlink(c.partial, page);
+                page->next = _pool;
+                _pool      = page;
+                ++_freePages;
+            }
+        }
+
+        [[nodiscard]] bool do_is_equal(const std::pmr::memory_resource& other) const noexcept override
+        {
+            return this == &other;
+        }
+
+        [[nodiscard]] std::size_t classOf(std::size_t bytes, std::size_t alignment) const noexcept
+        {
+            if (alignment > _align || _classes.empty() || bytes > _classes.back().size)
+            {
+                return _classes.size();
+            }
+            const auto it = std::lower_bound(_classes.begin(), _classes.end(), bytes, [](const SizeClass& c, std::size_t n) { return c.size < n; });
+            return static_cast<std::size_t>(it - _classes.begin());
+        }
+
+        [[nodiscard]] Page* pageOf(void* p) const noexcept
+        {
+            return reinterpret_cast<Page*>(reinterpret_cast<std::uintptr_t>(p) & ~(_pageSize - 1));
+        }
+
+        // Takes a page from the shared pool, or a new one from upstream, for class `cls`.
+        Page* acquirePage(std::size_t cls)
+        {
+            Page* page = _pool;
+            if (page)
+            {
+                _pool = page->next;
+                --_freePages;
+                if (page->cls != cls)
+                {
+                    ++_reassignments;
+                }
+            }
+            else
+            {
+                // Room is made first so that push_back() cannot throw once the page is held;
+                // growth stays geometric.
+                if (_pages.size() == _pages.capacity())
+                {
+                    _pages.reserve(std::max<std::size_t>(4, 2 * _pages.size()));
+                }
+                void* mem = _upstream->allocate(_pageSize, _pageSize);
+                _pages.push_back(mem);
+                page = ::new (mem) Page{};
+            }
+            page->cls      = cls;
+            page->used     = 0;
+            page->carved   = 0;
+            page->freeList = nullptr;
+            pushFront(_classes[cls].partial, page);
+            return page;
+        }
+
+        static void pushFront(Page*& head, Page* page) noexcept
+        {
+            page->prev = nullptr;
+            page->next = head;
+            if (head)
+            {
+                head->prev = page;
+            }
+            head = page;
+        }
+
+        static void unlink(Page*& head, Page* page) noexcept
+        {
+            if (page->prev)
+            {
+                page->prev->next = page->next;
+            }
+            else
+            {
+                head = page->next;
+            }
+            if (page->next)
+            {
+                page->next->prev = page->prev;
+            }
+            page->prev = nullptr;
+            page->next = nullptr;
+        }
+
+        void releasePages() noexcept
+        {
+            for (void* mem : _pages)
+            {
+                _upstream->deallocate(mem, _pageSize, _pageSize);
+            }
+            _pages.clear();
+            for (auto& c : _classes)
+            {
+                c.partial = nullptr;
+            }
+            _pool      = nullptr;
+            _freePages = 0;
+        }
+
+        std::pmr::memory_resource* _upstream;
+        const std::size_t          _pageSize;
+        std::vector<SizeClass>     _classes;
+        std::vector<void*>         _pages;
+        Page*                      _pool          = nullptr;
+        std::size_t                _freePages     = 0;
+        std::size_t                _live          = 0;
+        std::size_t                _reassignments = 0;
+    };
+} // namespace cache::memory
@@ -1,51 +1,129 @@
 #pragma once
 
+#include <Cache/Helpers/Hashing.hpp>
+#include <array>
+#include <cstddef>
+#include <cstring>
 #include <functional>
+#include <span>
 #include <tuple>
+#include <type_traits>
+#include <utility>
 
 namespace cache
 {
+    namespace detail
+    {
+        template <typename... Args>
+        [[nodiscard]] std::size_t hashArguments(const Args&... arguments) noexcept
+        {
+            std::uint64_t state = hashing::seed;
+            ((state = hashing::combine(state, arguments)), ...);
+            return static_cast<std::size_t>(hashing::finalize(state, sizeof...(Args)));
+        }
+
+        template <typename T>
+        concept Packable = std::is_trivially_copyable_v<T> && (std::has_unique_object_representations_v<T> || std::is_same_v<T, float> || std::is_same_v<T, double>);
+    } // namespace detail
+
     template <typename... Args>
     struct MethodCacheKey
     {
-        std::tuple<Args...> args;
-
-        MethodCacheKey(Args... arguments) : args(std::forward<Args>(arguments)...)
+        MethodCacheKey(Args... arguments) : _args(std::forward<Args>(arguments)...), _hash(std::apply(detail::hashArguments<Args...>, _args))
         { }
 
         [[nodiscard]] bool operator==(const MethodCacheKey& other) const
         {
-            return args == other.args;
+            return _hash == other._hash && _args == other._args;
+        }
+
+        [[nodiscard]] std::size_t hash() const noexcept
+        {
+            return _hash;
         }
+
+        template <std::size_t I>
+        [[nodiscard]] const auto& get() const noexcept
+        {
+            return std::get<I>(_args);
+        }
+
+        // Read-only: the hash is computed once from the arguments.
+        [[nodiscard]] const std::tuple<Args...>& args() const noexcept
+        {
+            return _args;
+        }
+
+      private:
+        std::tuple<Args...> _args;
+        std::size_t         _hash;
     };
 
-    namespace detail
+    // Arguments without padding bits are packed back to back into an 8-byte aligned
+    // buffer. Keys are then equal when their object representations are, so -0.0 and
+    // 0.0 are distinct arguments and a NaN argument matches the same NaN bits.
+    template <typename... Args>
+        requires(detail::Packable<Args> && ...)
+    struct MethodCacheKey<Args...>
     {
-        template <typename Tuple, std::size_t Index = std::tuple_size_v<Tuple>>
-        struct tuple_hash_impl
-        {
-            [[nodiscard]] static std::size_t apply(const Tuple& tuple)
-            {
-                if constexpr (Index == 0)
-                {
-                    return 0;
-                }
-                else
-                {
-                    auto rest_hash    = tuple_hash_impl<Tuple, Index - 1>::apply(tuple);
-                    auto element_hash = std::hash<std::tuple_element_t<Index - 1, Tuple>>{}(std::get<Index - 1>(tuple));
-                    return rest_hash ^ element_hash + 0x9e3779b97f4a7c15ull + (rest_hash << 6) + (rest_hash >> 2);
-                }
-            }
-        };
-    } // namespace detail
+        static constexpr std::size_t packedSize  = (std::size_t{0} + ... + sizeof(Args));
+        static constexpr std::size_t storageSize = (packedSize + 7) / 8 * 8;
+
+        MethodCacheKey(Args... arguments)
+        {
+            std::size_t i = 0;
+            (std::memcpy(_bytes.data() + offsets[i++], &arguments, sizeof(Args)), ...);
+            _hash = static_cast<std::size_t>(hashing::hashBytes(_bytes.data(), storageSize));
+        }
+
+        [[nodiscard]] bool operator==(const MethodCacheKey& other) const noexcept
+        {
+            return _hash == other._hash && std::memcmp(_bytes.data(), other._bytes.data(), storageSize) == 0;
+        }
+
+        [[nodiscard]] std::size_t hash() const noexcept
+        {
+            return _hash;
+        }
+
+        template <std::size_t I>
+        [[nodiscard]] auto get() const noexcept
+        {
+            std::tuple_element_t<I, std::tuple<Args...>> value;
+            std::memcpy(&value, _bytes.data() + offsets[I], sizeof(value));
+            return value;
+        }
+
+        // The arguments unpacked, as the primary template returns them.
+        [[nodiscard]] std::tuple<Args...> args() const noexcept
+        {
+            return [this]<std::size_t... I>(std::index_sequence<I...>) { return std::tuple<Args...>(get<I>()...); }(std::index_sequence_for<Args...>{});
+        }
+
+        [[nodiscard]] std::span<const std::byte, storageSize> bytes() const noexcept
+        {
+            return std::span<const std::byte, storageSize>(_bytes);
+        }
+
+      private:
+        static constexpr std::array<std::size_t, sizeof...(Args)> offsets = [] {
+            std::array<std::size_t, sizeof...(Args)> res{};
+            std::size_t                              i   = 0;
+            std::size_t                              off = 0;
+            ((res[i++] = off, off += sizeof(Args)), ...);
+            return res;
+        }();
+
+        alignas(std::uint64_t) std::array<std::byte, storageSize> _bytes{};
+        std::size_t _hash;
+    };
 } // namespace cache
 
 template <typename... Args>
 struct std::hash<cache::MethodCacheKey<Args...>>
 {
-    [[nodiscard]] std::size_t operator()(const cache::MethodCacheKey<Args...>& key) const
+    [[nodiscard]] std::size_t operator()(const cache::MethodCacheKey<Args...>& key) const noexcept
     {
-        return cache::detail::tuple_hash_impl<std::tuple<Args...>>::apply(key.args);
+        return key.hash();
     }
 };
@@ -4,6 +4,7 @@
 #include <Cache/Concepts/CacheConcepts.hpp>
 #include <Cache/Helpers/MutexLocks.hpp>
 #include <Cache/Interfaces/IStrategyCache.hpp>
+#include <Cache/Stats/CacheStats.hpp>
 #include <Cache/Strategy/LRU.hpp>
 #include <Cache/Utils/Singleton.hpp>
 #include <memory>
@@ -12,6 +13,7 @@
 #include <typeindex>
 #include <typeinfo>
 #include <unordered_map>
+#include <vector>
 
 struct CacheKey
 {
@@ -42,6 +44,13 @@ struct CacheKeyHash
 
 namespace cache
 {
+    struct MethodStats
+    {
+        std::string     className;
+        std::string     methodName;
+        stats::Snapshot snapshot;
+    };
+
     template <typename RegMutex = std::shared_mutex>
         requires concepts::MutexLike<RegMutex>
     class MethodManager final : public utils::Singleton<MethodManager<RegMutex>>
@@ -72,24 +81,58 @@ namespace cache
                 mutex_locks::ReadLock<decltype(_mtx)> rlock(_mtx);
                 if (auto it = _caches.find(key); it != _caches.end())
                 {
-                    return *static_cast<IStrategyCache<K, V>*>(it->second.get());
+                    return *static_cast<IStrategyCache<K, V>*>(it->second.cache.get());
                 }
             }
 
             mutex_locks::WriteLock<decltype(_mtx)> wlock(_mtx);
             if (auto it = _caches.find(key); it != _caches.end())
             {
-                return *static_cast<IStrategyCache<K, V>*>(it->second.get());
+                return *static_cast<IStrategyCache<K, V>*>(it->second.cache.get());
             }
 
             using CacheT = CacheType;
 
             auto    sp  = allocateCache<CacheT, K, V>(fragments, capacity);
             CacheT* raw = sp.get();
-            _caches.emplace(key, std::shared_ptr<void>(std::move(sp)));
+            _caches.emplace(key, Entry{std::shared_ptr<void>(std::move(sp)), [](const void* p) noexcept { return static_cast<const CacheT*>(p)->stats(); }});
             return *raw;
         }
 
+        // Resolves the registry entry once per Tag and caches the typed reference in a
+        // function-local static, so later calls skip key construction, hashing and _mtx.
+        template <
+            typename Tag, typename K, typename V,
+            typename Strategy   = strategy::LRU<K, V>,
+            typename Hash       = std::hash<K>,
+            typename Eq         = std::equal_to<K>,
+            typename CacheMutex = std::shared_mutex,
+            typename CacheType  = Base<K, V, Strategy, Hash, Eq, CacheMutex>>
+            requires concepts::MethodTagLike<Tag> &&
+                     concepts::StrategyLike<Strategy, K, V> &&
+                     concepts::MutexLike<CacheMutex> &&
+                     concepts::CacheLike<CacheType, K, V>
+
+        [[nodiscard]] CacheType& getTaggedMethodCache(std::size_t fragments = 4, std::size_t capacity = 128)
+        {
+            static CacheType& cache = dynamic_cast<CacheType&>(
+                getMethodCache<K, V, Strategy, Hash, Eq, CacheMutex, CacheType>(
+                    std::string(Tag::className), std::string(Tag::methodName), fragments, capacity));
+            return cache;
+        }
+
+        [[nodiscard]] std::vector<MethodStats> stats() const
+        {
+            mutex_locks::ReadLock<decltype(_mtx)> rlock(_mtx);
+            std::vector<MethodStats>              res;
+            res.reserve(_caches.size());
+            for (const auto& [key, entry] : _caches)
+            {
+                res.push_back(MethodStats{key.cls, key.method, entry.snapshot(entry.cache.get())});
+            }
+            return res;
+        }
+
       private:
         explicit MethodManager()  = default;
         ~MethodManager() noexcept = default;
@@ -134,7 +177,13 @@ namespace cache
             }
         }
 
-        mutable RegMutex                                                  _mtx;
-        std::unordered_map<CacheKey, std::shared_ptr<void>, CacheKeyHash> _caches;
+        struct Entry
+        {
+            std::shared_ptr<void> cache;
+            stats::Snapshot (*snapshot)(const void*) noexcept;
+        };
+
+        mutable RegMutex                                  _mtx;
+        std::unordered_map<CacheKey, Entry, CacheKeyHash> _caches;
     };
 } // namespace cache
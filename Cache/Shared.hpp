@@ -2,12 +2,18 @@
 
 #include <Cache/Base.hpp>
 #include <Cache/Concepts/CacheConcepts.hpp>
+#include <Cache/Concepts/StatsConcepts.hpp>
+#include <Cache/Concepts/WeigherConcepts.hpp>
 #include <Cache/Helpers/MutexLocks.hpp>
 #include <Cache/Interfaces/AStrategyCache.hpp>
+#include <Cache/Listener/RemovalListener.hpp>
+#include <Cache/Memory/Arena.hpp>
+#include <Cache/Stats/CacheStats.hpp>
 #include <Cache/Strategy/LRU.hpp>
 #include <Cache/Utils/Singleton.hpp>
 #include <functional>
 #include <memory>
+#include <memory_resource>
 #include <shared_mutex>
 #include <stdexcept>
 #include <type_traits>
@@ -16,13 +22,13 @@ namespace cache
 {
 
     template <typename K, typename V, typename Strategy = strategy::LRU<K, V>, typename Hash = std::hash<K>, typename Eq = std::equal_to<K>,
-              typename Mutex = std::shared_mutex>
+              typename Mutex = std::shared_mutex, typename Stats = stats::NoStats, typename Weigher = weigher::Unit>
 
-        requires concepts::StrategyLike<Strategy, K, V> && concepts::MutexLike<Mutex>
+        requires concepts::StrategyLike<Strategy, K, V> && concepts::MutexLike<Mutex> && concepts::StatsLike<Stats> && concepts::WeigherLike<Weigher, K, V>
 
-    class Shared final : public AStrategyCache<K, V>, public utils::Singleton<Shared<K, V, Strategy, Hash, Eq, Mutex>>
+    class Shared final : public AStrategyCache<K, V>, public utils::Singleton<Shared<K, V, Strategy, Hash, Eq, Mutex, Stats, Weigher>>
     {
-        friend class utils::Singleton<Shared<K, V, Strategy, Hash, Eq, Mutex>>;
+        friend class utils::Singleton<Shared<K, V, Strategy, Hash, Eq, Mutex, Stats, Weigher>>;
 
       public:
         using IsSharedCache = void;
@@ -35,22 +41,28 @@ namespace cache
             return static_cast<bool>(_cache);
         }
 
-        void initialize(std::size_t cap = 128)
+        void initialize(std::size_t cap = 128, std::pmr::memory_resource* upstream = std::pmr::get_default_resource(),
+                        memory::Allocation allocation = memory::Allocation::DIRECT)
         {
             mutex_locks::WriteLock<decltype(_mtx)> wlock(_mtx);
             if (!_cache)
             {
-                _cache = std::make_unique<Base<K, V, Strategy, Hash, Eq, mutex_locks::NoLock>>(cap);
+                _cache = std::make_unique<Base<K, V, Strategy, Hash, Eq, mutex_locks::NoLock, Stats, Weigher>>(cap, upstream, allocation);
+                _cache->retainRetired(true);
                 if (_invalidateCallback)
                 {
                     _cache->invalidateIf(std::move(_invalidateCallback));
                 }
+                if (_listener)
+                {
+                    _cache->setRemovalListener(std::move(_listener));
+                }
             }
         }
 
         [[nodiscard]] virtual bool get(const K& key, V& cacheOut) override
         {
-            mutex_locks::WriteLock<decltype(_mtx)> wlock(_mtx);
+            RetiringLock wlock(*this);
             if (_cache)
             {
                 return _cache->get(key, cacheOut);
@@ -60,7 +72,7 @@ namespace cache
 
         virtual void put(const K& key, const V& value) override
         {
-            mutex_locks::WriteLock<decltype(_mtx)> wlock(_mtx);
+            RetiringLock wlock(*this);
             if (_cache)
             {
                 _cache->put(key, value);
@@ -69,7 +81,7 @@ namespace cache
 
         virtual void remove(const K& key) override
         {
-            mutex_locks::WriteLock<decltype(_mtx)> wlock(_mtx);
+            RetiringLock wlock(*this);
             if (_cache)
             {
                 _cache->remove(key);
@@ -107,7 +119,7 @@ namespace cache
 
         virtual void clear() noexcept override
         {
-            mutex_locks::WriteLock<decltype(_mtx)> wlock(_mtx);
+            RetiringLock wlock(*this);
             if (_cache)
             {
                 _cache->clear();
@@ -126,6 +138,45 @@ namespace cache
             return _cache ? _cache->capacity() : 0;
         }
 
+        virtual void setCapacity(std::size_t cap) override
+        {
+            RetiringLock wlock(*this);
+            if (_cache)
+            {
+                _cache->setCapacity(cap);
+            }
+        }
+
+        virtual void setRemovalListener(listener::Listener<K, V> listener) override
+        {
+            mutex_locks::WriteLock<decltype(_mtx)> wlock(_mtx);
+            if (_cache)
+            {
+                _cache->setRemovalListener(std::move(listener));
+            }
+            else
+            {
+                _listener = std::move(listener);
+            }
+        }
+
+        [[nodiscard]] virtual stats::Snapshot stats() const noexcept override
+        {
+            mutex_locks::ReadLock<decltype(_mtx)> rlock(_mtx);
+            stats::Snapshot                       res = _cache ? _cache->stats() : stats::Snapshot{};
+            // The inner cache runs without a lock; contention happens on the wrapper mutex.
+            res.lockWait = _lockStats.snapshot().lockWait;
+            return res;
+        }
+
+        [[nodiscard]] virtual memory::Usage memoryUsage() const override
+        {
+            mutex_locks::ReadLock<decltype(_mtx)> rlock(_mtx);
+            memory::Usage                         res = _cache ? _cache->memoryUsage() : memory::Usage{};
+            res.overheadBytes += sizeof(*this);
+            return res;
+        }
+
         [[nodiscard]] virtual bool isMtSafe() const noexcept override
         {
             if constexpr (std::is_same_v<Mutex, mutex_locks::NoLock>)
@@ -140,7 +191,7 @@ namespace cache
 
         [[nodiscard]] bool putConditional(const K& key, const V& value, PutRequirement req) override
         {
-            mutex_locks::WriteLock<decltype(_mtx)> wlock(_mtx);
+            RetiringLock wlock(*this);
             if (!_cache)
             {
                 return false;
@@ -156,19 +207,56 @@ namespace cache
         {
             if (!countAsAccess)
             {
+                // A lookup only mutates the inner cache when it finds an invalidated entry.
                 mutex_locks::ReadLock<decltype(_mtx)> rlock(_mtx);
-                return _cache && _cache->contains(key);
+                if (!_cache)
+                {
+                    return false;
+                }
+                if (!_cache->hasInvalidationPredicate())
+                {
+                    return _cache->contains(key);
+                }
             }
 
-            mutex_locks::WriteLock<decltype(_mtx)> wlock(_mtx);
-            return _cache && _cache->contains(key, true);
+            RetiringLock wlock(*this);
+            return _cache && _cache->contains(key, countAsAccess);
         }
 
       private:
         constexpr explicit Shared() = default;
 
-        mutable Mutex                                                        _mtx;
-        std::unique_ptr<Base<K, V, Strategy, Hash, Eq, mutex_locks::NoLock>> _cache;
-        std::function<bool(const K&, const V&)>                              _invalidateCallback = nullptr;
+        // The inner cache keeps what it drops; it is reported and destroyed once the wrapper
+        // lock has been released.
+        class RetiringLock
+        {
+          public:
+            explicit RetiringLock(Shared& shared) : _shared(shared), _lock(shared.writeLock())
+            { }
+
+            ~RetiringLock() noexcept
+            {
+                if (_shared._cache)
+                {
+                    _shared._cache->takeRetired(_dead);
+                }
+            }
+
+          private:
+            listener::Retired<K, V>       _dead;
+            Shared&                       _shared;
+            mutex_locks::WriteLock<Mutex> _lock;
+        };
+
+        [[nodiscard]] mutex_locks::WriteLock<Mutex> writeLock()
+        {
+            return stats::timedLock<mutex_locks::WriteLock<Mutex>>(_mtx, _lockStats);
+        }
+
+        mutable Mutex                                                                        _mtx;
+        std::unique_ptr<Base<K, V, Strategy, Hash, Eq, mutex_locks::NoLock, Stats, Weigher>> _cache;
+        std::function<bool(const K&, const V&)>                                              _invalidateCallback = nullptr;
+        listener::Listener<K, V>                                                             _listener;
+        [[no_unique_address]] std::conditional_t<Stats::timed, Stats, stats::NoStats>        _lockStats;
     };
 } // namespace cache
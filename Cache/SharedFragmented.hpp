@@ -1,12 +1,18 @@
 #pragma once
 
 #include <Cache/Concepts/CacheConcepts.hpp>
+#include <Cache/Concepts/StatsConcepts.hpp>
+#include <Cache/Concepts/WeigherConcepts.hpp>
 #include <Cache/Fragmented.hpp>
 #include <Cache/Helpers/MutexLocks.hpp>
 #include <Cache/Interfaces/AStrategyCache.hpp>
+#include <Cache/Listener/RemovalListener.hpp>
+#include <Cache/Memory/Arena.hpp>
+#include <Cache/Stats/CacheStats.hpp>
 #include <Cache/Strategy/LRU.hpp>
 #include <Cache/Utils/Singleton.hpp>
 #include <memory>
+#include <memory_resource>
 #include <shared_mutex>
 #include <type_traits>
 
@@ -14,16 +20,18 @@ namespace cache
 {
 
     template <typename K, typename V, typename Strategy = strategy::LRU<K, V>, typename Hash = std::hash<K>, typename Eq = std::equal_to<K>,
-              typename WrapperMutex = std::shared_mutex, typename FragMutex = std::shared_mutex, typename FragmentMutex = std::mutex>
+              typename WrapperMutex = std::shared_mutex, typename FragMutex = std::shared_mutex, typename FragmentMutex = std::mutex, typename Stats = stats::NoStats,
+              typename Weigher = weigher::Unit>
 
-        requires concepts::StrategyLike<Strategy, K, V> && concepts::MutexLike<WrapperMutex> && concepts::MutexLike<FragMutex> && concepts::MutexLike<FragmentMutex>
+        requires concepts::StrategyLike<Strategy, K, V> && concepts::MutexLike<WrapperMutex> && concepts::MutexLike<FragMutex> && concepts::MutexLike<FragmentMutex> && concepts::StatsLike<Stats> &&
+                 concepts::WeigherLike<Weigher, K, V>
 
-    class SharedFragmented final : public AStrategyCache<K, V>, public utils::Singleton<SharedFragmented<K, V, Strategy, Hash, Eq, WrapperMutex, FragMutex, FragmentMutex>>
+    class SharedFragmented final : public AStrategyCache<K, V>, public utils::Singleton<SharedFragmented<K, V, Strategy, Hash, Eq, WrapperMutex, FragMutex, FragmentMutex, Stats, Weigher>>
     {
 
-        using FragmentedType = Fragmented<K, V, Strategy, Hash, Eq, FragMutex, FragmentMutex>;
+        using FragmentedType = Fragmented<K, V, Strategy, Hash, Eq, FragMutex, FragmentMutex, Stats, Weigher>;
 
-        friend class utils::Singleton<SharedFragmented<K, V, Strategy, Hash, Eq, WrapperMutex, FragMutex, FragmentMutex>>;
+        friend class utils::Singleton<SharedFragmented<K, V, Strategy, Hash, Eq, WrapperMutex, FragMutex, FragmentMutex, Stats, Weigher>>;
 
       public:
         using IsSharedCache     = void;
@@ -31,16 +39,21 @@ namespace cache
 
         ~SharedFragmented() noexcept override = default;
 
-        void initialize(std::size_t fragments = 4, std::size_t cap = 128)
+        void initialize(std::size_t fragments = 4, std::size_t cap = 128, std::pmr::memory_resource* upstream = std::pmr::get_default_resource(),
+                        memory::Allocation allocation = memory::Allocation::DIRECT)
         {
             mutex_locks::WriteLock<decltype(_mtx)> w(_mtx);
             if (!_cache)
             {
-                _cache = std::make_unique<FragmentedType>(fragments, cap);
+                _cache = std::make_unique<FragmentedType>(fragments, cap, upstream, allocation);
                 if (_invalidateCallback)
                 {
                     _cache->invalidateIf(std::move(_invalidateCallback));
                 }
+                if (_listener)
+                {
+                    _cache->setRemovalListener(std::move(_listener));
+                }
             }
         }
 
@@ -102,6 +115,19 @@ namespace cache
             }
         }
 
+        void setRemovalListener(listener::Listener<K, V> listener) override
+        {
+            mutex_locks::WriteLock<decltype(_mtx)> w(_mtx);
+            if (_cache)
+            {
+                _cache->setRemovalListener(std::move(listener));
+            }
+            else
+            {
+                _listener = std::move(listener);
+            }
+        }
+
         [[nodiscard]] bool hasInvalidationPredicate() const noexcept override
         {
             mutex_locks::ReadLock<decltype(_mtx)> r(_mtx);
@@ -149,6 +175,41 @@ namespace cache
             return f ? f->capacity() : 0;
         }
 
+        void setCapacity(std::size_t cap) override
+        {
+            FragmentedType* f = nullptr;
+            {
+                mutex_locks::ReadLock<decltype(_mtx)> r(_mtx);
+                f = _cache.get();
+            }
+            if (f)
+            {
+                f->setCapacity(cap);
+            }
+        }
+
+        [[nodiscard]] stats::Snapshot stats() const noexcept override
+        {
+            FragmentedType* f = nullptr;
+            {
+                mutex_locks::ReadLock<decltype(_mtx)> r(_mtx);
+                f = _cache.get();
+            }
+            return f ? f->stats() : stats::Snapshot{};
+        }
+
+        [[nodiscard]] memory::Usage memoryUsage() const override
+        {
+            FragmentedType* f = nullptr;
+            {
+                mutex_locks::ReadLock<decltype(_mtx)> r(_mtx);
+                f = _cache.get();
+            }
+            memory::Usage res = f ? f->memoryUsage() : memory::Usage{};
+            res.overheadBytes += sizeof(*this);
+            return res;
+        }
+
         [[nodiscard]] bool isMtSafe() const noexcept override
         {
             if constexpr (std::is_same_v<WrapperMutex, mutex_locks::NoLock>)
@@ -199,6 +260,7 @@ namespace cache
         mutable WrapperMutex                    _mtx;
         std::unique_ptr<FragmentedType>         _cache;
         std::function<bool(const K&, const V&)> _invalidateCallback = nullptr;
+        listener::Listener<K, V>                _listener;
     };
 
 } // namespace cache
@@ -0,0 +1,428 @@
+#pragma once
+
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <bit>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <type_traits>
+
+namespace cache::stats
+{
+    enum class Op
+    {
+        GET,
+        PUT
+    };
+
+    // Log-bucketed latency histogram: exact below 8ns, then 8 linear sub-buckets per
+    // power of two (<= 12.5% relative error), saturating at 2^40ns.
+    struct Histogram
+    {
+        static constexpr std::size_t subBits     = 3;
+        static constexpr std::size_t subBuckets  = std::size_t{1} << subBits;
+        static constexpr std::size_t maxExponent = 40;
+        static constexpr std::size_t bucketCount = subBuckets + (maxExponent - subBits) * subBuckets;
+
+        std::array<std::uint64_t, bucketCount> counts{};
+
+        [[nodiscard]] static constexpr std::size_t bucketFor(std::uint64_t ns) noexcept
+        {
+            if (ns < subBuckets)
+            {
+                return static_cast<std::size_t>(ns);
+            }
+            if (std::bit_width(ns) > maxExponent)
+            {
+                return bucketCount - 1;
+            }
+            const std::size_t exponent = std::bit_width(ns) - 1;
+            const std::size_t sub      = static_cast<std::size_t>(ns >> (exponent - subBits)) & (subBuckets - 1);
+            return subBuckets + (exponent - subBits) * subBuckets + sub;
+        }
+
+        [[nodiscard]] static constexpr std::uint64_t upperBound(std::size_t bucket) noexcept
+        {
+            if (bucket < subBuckets)
+            {
+                return bucket;
+            }
+            const std::size_t exponent = (bucket - subBuckets) / subBuckets + subBits;
+            const std::size_t sub      = (bucket - subBuckets) % subBuckets;
+            return ((subBuckets + sub + 1) << (exponent - subBits)) - 1;
+        }
+
+        [[nodiscard]] std::uint64_t count() const noexcept
+        {
+            std::uint64_t res = 0;
+            for (auto c : counts)
+            {
+                res += c;
+            }
+            return res;
+        }
+
+        [[nodiscard]] std::chrono::nanoseconds percentile(double q) const noexcept
+        {
+            const std::uint64_t total = count();
+            if (total == 0)
+            {
+                return std::chrono::nanoseconds(0);
+            }
+            const double        clamped = std::clamp(q, 0.0, 1.0);
+            const std::uint64_t rank    = std::max<std::uint64_t>(1, static_cast<std::uint64_t>(clamped * static_cast<double>(total) + 0.5));
+            std::uint64_t       seen    = 0;
+            for (std::size_t i = 0; i < bucketCount; ++i)
+            {
+                seen += counts[i];
+                if (seen >= rank)
+                {
+                    return std::chrono::nanoseconds(upperBound(i));
+                }
+            }
+            return std::chrono::nanoseconds(upperBound(bucketCount - 1));
+        }
+
+        Histogram& operator+=(const Histogram& rhs) noexcept
+        {
+            for (std::size_t i = 0; i < bucketCount; ++i)
+            {
+                counts[i] += rhs.counts[i];
+            }
+            return *this;
+        }
+    };
+
+    struct Snapshot
+    {
+        std::uint64_t            hits          = 0;
+        std::uint64_t            misses        = 0;
+        std::uint64_t            puts          = 0;
+        std::uint64_t            evictions     = 0;
+        std::uint64_t            invalidations = 0;
+        std::uint64_t            loadSuccesses = 0;
+        std::uint64_t            loadFailures  = 0;
+        std::chrono::nanoseconds totalLoadTime{0};
+        Histogram                getLatency;
+        Histogram                putLatency;
+        Histogram                lockWait;
+
+        [[nodiscard]] double hitRatio() const noexcept
+        {
+            const std::uint64_t lookups = hits + misses;
+            return lookups == 0 ? 0.0 : static_cast<double>(hits) / static_cast<double>(lookups);
+        }
+
+        Snapshot& operator+=(const Snapshot& rhs) noexcept
+        {
+            hits += rhs.hits;
+            misses += rhs.misses;
+            puts += rhs.puts;
+            evictions += rhs.evictions;
+            invalidations += rhs.invalidations;
+            loadSuccesses += rhs.loadSuccesses;
+            loadFailures += rhs.loadFailures;
+            totalLoadTime += rhs.totalLoadTime;
+            getLatency += rhs.getLatency;
+            putLatency += rhs.putLatency;
+            lockWait += rhs.lockWait;
+            return *this;
+        }
+    };
+
+    struct NoStats
+    {
+        static constexpr bool enabled = false;
+        static constexpr bool timed   = false;
+
+        void recordHit() noexcept
+        { }
+
+        void recordMiss() noexcept
+        { }
+
+        void recordPut() noexcept
+        { }
+
+        void recordEviction() noexcept
+        { }
+
+        void recordInvalidation() noexcept
+        { }
+
+        void recordLoadSuccess(std::chrono::nanoseconds) noexcept
+        { }
+
+        void recordLoadFailure(std::chrono::nanoseconds) noexcept
+        { }
+
+        void recordLatency(Op, std::chrono::nanoseconds) noexcept
+        { }
+
+        void recordLockWait(std::chrono::nanoseconds) noexcept
+        { }
+
+        [[nodiscard]] Snapshot snapshot() const noexcept
+        {
+            return {};
+        }
+    };
+
+    // Each thread is assigned a stripe round-robin on first use, so up to `Stripes`
+    // threads record into distinct cache lines and never contend on a counter.
+    [[nodiscard]] inline std::size_t threadStripe() noexcept
+    {
+        static std::atomic<std::size_t> next{0};
+        thread_local const std::size_t  stripe = next.fetch_add(1, std::memory_order_relaxed);
+        return stripe;
+    }
+
+    template <std::size_t Stripes = 16>
+    class StripedStats
+    {
+        static_assert(Stripes > 0, "StripedStats needs at least one stripe");
+
+      public:
+        static constexpr bool enabled = true;
+        static constexpr bool timed   = false;
+
+        void recordHit() noexcept
+        {
+            add(HIT, 1);
+        }
+
+        void recordMiss() noexcept
+        {
+            add(MISS, 1);
+        }
+
+        void recordPut() noexcept
+        {
+            add(PUT, 1);
+        }
+
+        void recordEviction() noexcept
+        {
+            add(EVICTION, 1);
+        }
+
+        void recordInvalidation() noexcept
+        {
+            add(INVALIDATION, 1);
+        }
+
+        void recordLoadSuccess(std::chrono::nanoseconds elapsed) noexcept
+        {
+            add(LOAD_SUCCESS, 1);
+            add(LOAD_TIME_NS, static_cast<std::uint64_t>(elapsed.count()));
+        }
+
+        void recordLoadFailure(std::chrono::nanoseconds elapsed) noexcept
+        {
+            add(LOAD_FAILURE, 1);
+            add(LOAD_TIME_NS, static_cast<std::uint64_t>(elapsed.count()));
+        }
+
+        void recordLatency(Op, std::chrono::nanoseconds) noexcept
+        { }
+
+        void recordLockWait(std::chrono::nanoseconds) noexcept
+        { }
+
+        [[nodiscard]] Snapshot snapshot() const noexcept
+        {
+            std::array<std::uint64_t, COUNTER_COUNT> sums{};
+            for (const auto& stripe : _stripes)
+            {
+                for (std::size_t i = 0; i < COUNTER_COUNT; ++i)
+                {
+                    sums[i] += stripe.counters[i].load(std::memory_order_relaxed);
+                }
+            }
+            Snapshot res;
+            res.hits          = sums[HIT];
+            res.misses        = sums[MISS];
+            res.puts          = sums[PUT];
+            res.evictions     = sums[EVICTION];
+            res.invalidations = sums[INVALIDATION];
+            res.loadSuccesses = sums[LOAD_SUCCESS];
+            res.loadFailures  = sums[LOAD_FAILURE];
+            res.totalLoadTime = std::chrono::nanoseconds(sums[LOAD_TIME_NS]);
+            return res;
+        }
+
+      private:
+        enum Counter : std::size_t
+        {
+            HIT,
+            MISS,
+            PUT,
+            EVICTION,
+            INVALIDATION,
+            LOAD_SUCCESS,
+            LOAD_FAILURE,
+            LOAD_TIME_NS,
+            COUNTER_COUNT
+        };
+
+        struct alignas(64) Stripe
+        {
+            std::array<std::atomic<std::uint64_t>, COUNTER_COUNT> counters{};
+        };
+
+        void add(Counter counter, std::uint64_t n) noexcept
+        {
+            _stripes[threadStripe() % Stripes].counters[counter].fetch_add(n, std::memory_order_relaxed);
+        }
+
+        std::array<Stripe, Stripes> _stripes{};
+    };
+
+    // StripedStats counters plus per-stripe latency histograms for get/put and for
+    // the time spent waiting on the cache mutex.
+    template <std::size_t Stripes = 4>
+    class TimedStats
+    {
+      public:
+        static constexpr bool enabled = true;
+        static constexpr bool timed   = true;
+
+        void recordHit() noexcept
+        {
+            _counters.recordHit();
+        }
+
+        void recordMiss() noexcept
+        {
+            _counters.recordMiss();
+        }
+
+        void recordPut() noexcept
+        {
+            _counters.recordPut();
+        }
+
+        void recordEviction() noexcept
+        {
+            _counters.recordEviction();
+        }
+
+        void recordInvalidation() noexcept
+        {
+            _counters.recordInvalidation();
+        }
+
+        void recordLoadSuccess(std::chrono::nanoseconds elapsed) noexcept
+        {
+            _counters.recordLoadSuccess(elapsed);
+        }
+
+        void recordLoadFailure(std::chrono::nanoseconds elapsed) noexcept
+        {
+            _counters.recordLoadFailure(elapsed);
+        }
+
+        void recordLatency(Op op, std::chrono::nanoseconds elapsed) noexcept
+        {
+            auto& stripe = _stripes[threadStripe() % Stripes];
+            add(op == Op::GET ? stripe.get : stripe.put, elapsed);
+        }
+
+        void recordLockWait(std::chrono::nanoseconds elapsed) noexcept
+        {
+            add(_stripes[threadStripe() % Stripes].lockWait, elapsed);
+        }
+
+        [[nodiscard]] Snapshot snapshot() const noexcept
+        {
+            Snapshot res = _counters.snapshot();
+            for (const auto& stripe : _stripes)
+            {
+                collect(res.getLatency, stripe.get);
+                collect(res.putLatency, stripe.put);
+                collect(res.lockWait, stripe.lockWait);
+            }
+            return res;
+        }
+
+      private:
+        using AtomicBuckets = std::array<std::atomic<std::uint64_t>, Histogram::bucketCount>;
+
+        struct alignas(64) Stripe
+        {
+            AtomicBuckets get{};
+            AtomicBuckets put{};
+            AtomicBuckets lockWait{};
+        };
+
+        static void add(AtomicBuckets& buckets, std::chrono::nanoseconds elapsed) noexcept
+        {
+            const auto ns = static_cast<std::uint64_t>(std::max<std::int64_t>(0, elapsed.count()));
+            buckets[Histogram::bucketFor(ns)].fetch_add(1, std::memory_order_relaxed);
+        }
+
+        static void collect(Histogram& out, const AtomicBuckets& buckets) noexcept
+        {
+            for (std::size_t i = 0; i < Histogram::bucketCount; ++i)
+            {
+                out.counts[i] += buckets[i].load(std::memory_order_relaxed);
+            }
+        }
+
+        StripedStats<Stripes>       _counters;
+        std::array<Stripe, Stripes> _stripes{};
+    };
+
+    // Acquires `Lock` on `mtx`, recording the time spent blocked when the policy is timed.
+    template <typename Lock, typename Stats>
+    [[nodiscard]] Lock timedLock(typename Lock::mutex_type& mtx, Stats& stats)
+    {
+        if constexpr (Stats::timed)
+        {
+            const auto start = std::chrono::steady_clock::now();
+            Lock       lock(mtx);
+            stats.recordLockWait(std::chrono::steady_clock::now() - start);
+            return lock;
+        }
+        else
+        {
+            return Lock(mtx);
+        }
+    }
+
+    // Records the lifetime of the scope as an operation latency; compiles to nothing
+    // for policies that are not timed.
+    template <typename Stats>
+    class LatencyTimer
+    {
+      public:
+        LatencyTimer(Stats& stats, Op op) noexcept : _stats(stats), _op(op)
+        {
+            if constexpr (Stats::timed)
+            {
+                _start = std::chrono::steady_clock::now();
+            }
+        }
+
+        ~LatencyTimer() noexcept
+        {
+            if constexpr (Stats::timed)
+            {
+                _stats.recordLatency(_op, std::chrono::steady_clock::now() - _start);
+            }
+        }
+
+        LatencyTimer(const LatencyTimer&)            = delete;
+        LatencyTimer& operator=(const LatencyTimer&) = delete;
+
+      private:
+        struct Empty
+        { };
+
+        Stats&                                                                                               _stats;
+        Op                                                                                                   _op;
+        [[no_unique_address]] std::conditional_t<Stats::timed, std::chrono::steady_clock::time_point, Empty> _start;
+    };
+} // namespace cache::stats
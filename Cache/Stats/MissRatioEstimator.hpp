@@ -0,0 +1,222 @@
+#pragma once
+
+#include <Cache/Helpers/Hashing.hpp>
+#include <algorithm>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <mutex>
+#include <set>
+#include <stdexcept>
+#include <unordered_map>
+#include <vector>
+
+namespace cache::stats
+{
+    // Fixed-size SHARDS: estimates the LRU miss ratio curve of an access stream from a spatially
+    // hashed sample of at most `maxSamples` keys. Reuse distances of sampled keys are computed
+    // with a Fenwick tree over access times, scaled by the sampling rate and bucketed up to 4x
+    // the reference capacity, so memory stays constant whatever the key space.
+    class MissRatioEstimator
+    {
+      public:
+        struct CurvePoint
+        {
+            double      scale;
+            std::size_t size;
+            double      hitRatio;
+        };
+
+        explicit MissRatioEstimator(std::size_t capacity, std::size_t maxSamples = 8192, std::size_t buckets = 256)
+            : _capacity(capacity), _maxSamples(maxSamples), _bucketWidth(static_cast<double>(4 * capacity) / static_cast<double>(buckets)),
+              _histogram(buckets, 0.0), _tree(4 * maxSamples + 1, 0)
+        {
+            if (capacity == 0 || maxSamples == 0 || buckets == 0)
+            {
+                throw(std::invalid_argument("Capacity, sample size and bucket count must be positive."));
+            }
+            _lastAccess.reserve(maxSamples + 1);
+        }
+
+        void access(std::uint64_t keyHash)
+        {
+            // Only sampled hashes take the lock; the threshold only goes down, so one above
+            // it is out of the sample for good.
+            const std::uint64_t h = hashing::mix(keyHash, hashing::seed);
+            _references.fetch_add(1, std::memory_order_relaxed);
+            if (h > _threshold.load(std::memory_order_relaxed))
+            {
+                return;
+            }
+            std::lock_guard<std::mutex> lock(_mtx);
+            if (h > _threshold.load(std::memory_order_relaxed))
+            {
+                return;
+            }
+            _sampled += 1.0;
+
+            if (_now + 1 >= _tree.size())
+            {
+                compact();
+            }
+            const std::size_t now = ++_now;
+
+            auto it = _lastAccess.find(h);
+            if (it != _lastAccess.end())
+            {
+                const std::size_t distinct = prefix(now - 1) - prefix(it->second);
+                const double      scaled   = static_cast<double>(distinct) / rate();
+                const std::size_t bucket   = static_cast<std::size_t>(scaled / _bucketWidth);
+                if (bucket < _histogram.size())
+                {
+                    _histogram[bucket] += 1.0;
+                }
+                update(it->second, -1);
+                it->second = now;
+                update(now, 1);
+                return;
+            }
+
+            _lastAccess.emplace(h, now);
+            _samples.insert(h);
+            update(now, 1);
+            if (_samples.size() > _maxSamples)
+            {
+                shrinkSample();
+            }
+        }
+
+        // Predicted LRU hit ratio for a cache of `size` entries (up to 4x the reference capacity).
+        [[nodiscard]] double hitRatioAt(std::size_t size) const
+        {
+            std::lock_guard<std::mutex> lock(_mtx);
+            const std::uint64_t         references = _references.load(std::memory_order_relaxed);
+            if (references == 0)
+            {
+                return 0.0;
+            }
+            // SHARDS-adj: the expected number of sampled references is references * rate; the
+            // shortfall (or excess) is credited to the smallest distances.
+            const double expected = static_cast<double>(references) * rate();
+            const double adjust   = expected - _sampled;
+            double       hits     = size > 0 ? adjust : 0.0;
+            for (std::size_t b = 0; b < _histogram.size(); ++b)
+            {
+                const double lo = static_cast<double>(b) * _bucketWidth;
+                const double hi = lo + _bucketWidth;
+                if (hi <= static_cast<double>(size))
+                {
+                    hits += _histogram[b];
+                }
+                else
+                {
+                    if (lo < static_cast<double>(size))
+                    {
+                        hits += _histogram[b] * (static_cast<double>(size) - lo) / _bucketWidth;
+                    }
+                    break;
+                }
+            }
+            return std::clamp(hits / expected, 0.0, 1.0);
+        }
+
+        [[nodiscard]] std::vector<CurvePoint> curve() const
+        {
+            std::vector<CurvePoint> res;
+            for (double scale : {0.5, 1.0, 2.0, 4.0})
+            {
+                const auto size = static_cast<std::size_t>(scale * static_cast<double>(_capacity));
+                res.push_back({scale, size, hitRatioAt(size)});
+            }
+            return res;
+        }
+
+        [[nodiscard]] double samplingRate() const
+        {
+            std::lock_guard<std::mutex> lock(_mtx);
+            return rate();
+        }
+
+        [[nodiscard]] std::size_t capacity() const noexcept
+        {
+            return _capacity;
+        }
+
+      private:
+        [[nodiscard]] double rate() const noexcept
+        {
+            return (static_cast<double>(_threshold.load(std::memory_order_relaxed)) + 1.0) / 18446744073709551616.0;
+        }
+
+        // Drops the sampled key with the largest hash and lowers the threshold below it; counts
+        // gathered at the old rate are rescaled to the new one.
+        void shrinkSample()
+        {
+            const double old    = rate();
+            auto         last   = std::prev(_samples.end());
+            auto         access = _lastAccess.find(*last);
+            update(access->second, -1);
+            _lastAccess.erase(access);
+            _threshold.store(*last - 1, std::memory_order_relaxed);
+            _samples.erase(last);
+
+            const double ratio = rate() / old;
+            for (auto& count : _histogram)
+            {
+                count *= ratio;
+            }
+            _sampled *= ratio;
+        }
+
+        // Renumbers the live access times 1..n (order preserved) once the time axis is full.
+        void compact()
+        {
+            std::vector<std::pair<std::size_t, std::uint64_t>> live;
+            live.reserve(_lastAccess.size());
+            for (const auto& [hash, time] : _lastAccess)
+            {
+                live.emplace_back(time, hash);
+            }
+            std::sort(live.begin(), live.end());
+            std::fill(_tree.begin(), _tree.end(), 0);
+            _now = 0;
+            for (const auto& [time, hash] : live)
+            {
+                _lastAccess[hash] = ++_now;
+                update(_now, 1);
+            }
+        }
+
+        void update(std::size_t i, int delta) noexcept
+        {
+            for (; i < _tree.size(); i += i & (~i + 1))
+            {
+                _tree[i] += delta;
+            }
+        }
+
+        [[nodiscard]] std::size_t prefix(std::size_t i) const noexcept
+        {
+            std::int64_t res = 0;
+            for (; i > 0; i -= i & (~i + 1))
+            {
+                res += _tree[i];
+            }
+            return static_cast<std::size_t>(res);
+        }
+
+        const std::size_t _capacity;
+        const std::size_t _maxSamples;
+        const double      _bucketWidth;
+
+        mutable std::mutex                             _mtx;
+        std::atomic<std::uint64_t>                     _threshold{~std::uint64_t{0}};
+        std::atomic<std::uint64_t>                     _references{0};
+        double                                         _sampled = 0.0;
+        std::size_t                                    _now     = 0;
+        std::vector<double>                            _histogram;
+        std::vector<std::int32_t>                      _tree;
+        std::unordered_map<std::uint64_t, std::size_t> _lastAccess;
+        std::set<std::uint64_t>                        _samples;
+    };
+} // namespace cache::stats
@@ -0,0 +1,382 @@
+#pragma once
+
+#include <Cache/Concepts/CacheConcepts.hpp>
+#include <Cache/Concepts/StatsConcepts.hpp>
+#include <Cache/Stats/CacheStats.hpp>
+#include <Cache/Store/Interfaces/ILoader.hpp>
+#include <Cache/Store/Interfaces/IWriter.hpp>
+#include <Cache/Utils/NonCopyable.hpp>
+#include <algorithm>
+#include <chrono>
+#include <condition_variable>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <optional>
+#include <span>
+#include <stdexcept>
+#include <thread>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+namespace cache::store
+{
+    enum class WriteMode
+    {
+        THROUGH, // put() and remove() reach the store before returning
+        BEHIND   // changes are coalesced per key and written in batches by a background thread
+    };
+
+    struct WriteBehind
+    {
+        // Keys per writeAll() call; a full batch wakes the writer thread at once.
+        std::size_t batchSize = 256;
+        // Otherwise the writer thread wakes this often.
+        std::chrono::milliseconds interval = std::chrono::milliseconds(100);
+        // put() and remove() wait while this many keys are queued.
+        std::size_t maxPending = 65536;
+    };
+
+    // Puts a cache in front of a backing store: get() reads through to the loader on a miss,
+    // put() and remove() go to the writer either synchronously or, with BEHIND, through a
+    // queue holding the latest change per key. Queued changes are served to get() until
+    // written, so the cache never reloads a value the store has not seen yet. Loads run
+    // outside the cache lock and are recorded in `Stats`. `Cache` is not owned.
+    template <typename Cache, typename Stats = stats::NoStats, typename Hash = std::hash<typename Cache::KeyType>,
+              typename Eq = std::equal_to<typename Cache::KeyType>>
+
+        requires concepts::CacheLike<Cache, typename Cache::KeyType, typename Cache::ValType> && concepts::StatsLike<Stats>
+
+    class Backed final : public utils::NonCopyable
+    {
+      public:
+        using KeyType = typename Cache::KeyType;
+        using ValType = typename Cache::ValType;
+        using Loader  = ILoader<KeyType, ValType>;
+        using Writer  = IWriter<KeyType, ValType>;
+        using Change  = Write<KeyType, ValType>;
+
+        // Either store may be null: without a loader misses stay misses, without a writer (only
+        // allowed with THROUGH) changes stay in the cache.
+        Backed(Cache& cache, std::shared_ptr<Loader> loader, std::shared_ptr<Writer> writer, WriteMode mode = WriteMode::THROUGH, WriteBehind options = {})
+            : _cache(cache), _loader(std::move(loader)), _writer(std::move(writer)), _mode(mode), _options(options)
+        {
+            if (_mode == WriteMode::BEHIND)
+            {
+                if (!_writer)
+                {
+                    throw(std::invalid_argument("Write-behind needs a writer."));
+                }
+                if (_options.batchSize < 1 || _options.maxPending < 1 || _options.interval <= std::chrono::milliseconds(0))
+                {
+                    throw(std::invalid_argument("Write-behind needs a non-null batch size, queue size and interval."));
+                }
+                _flusher = std::thread([this] { run(); });
+            }
+        }
+
+        // Writes out whatever is still queued before returning; changes the store rejects at
+        // that point are dropped.
+        ~Backed() noexcept
+        {
+            if (_flusher.joinable())
+            {
+                {
+                    std::lock_guard<std::mutex> lock(_mtx);
+                    _stopping = true;
+                }
+                _wake.notify_all();
+                _flusher.join();
+            }
+        }
+
+        [[nodiscard]] bool get(const KeyType& key, ValType& cacheOut)
+        {
+            if (_cache.get(key, cacheOut))
+            {
+                return true;
+            }
+            if (_mode == WriteMode::BEHIND)
+            {
+                std::optional<ValType> queued;
+                if (findQueued(key, queued))
+                {
+                    if (!queued)
+                    {
+                        return false;
+                    }
+                    (void) _cache.putIfAbsent(key, *queued);
+                    cacheOut = std::move(*queued);
+                    return true;
+                }
+            }
+            return _loader && load(key, cacheOut);
+        }
+
+        void put(const KeyType& key, const ValType& value)
+        {
+            if (_mode == WriteMode::BEHIND)
+            {
+                // Queued first: a get() missing in between finds the change instead of the store.
+                stage(key, value);
+            }
+            else if (_writer)
+            {
+                _writer->write(key, value);
+            }
+            _cache.put(key, value);
+        }
+
+        void remove(const KeyType& key)
+        {
+            if (_mode == WriteMode::BEHIND)
+            {
+                stage(key, std::nullopt);
+            }
+            else if (_writer)
+            {
+                _writer->erase(key);
+            }
+            _cache.remove(key);
+        }
+
+        // Waits until every change queued so far has been handed to the writer. Returns false
+        // when the store rejected some of them; they stay queued and are retried.
+        bool flush()
+        {
+            if (_mode != WriteMode::BEHIND)
+            {
+                return true;
+            }
+            std::unique_lock<std::mutex> lock(_mtx);
+            const std::uint64_t          failures = _failures;
+            const std::uint64_t          target   = _cycles + (_writing ? 2 : 1);
+            _flushRequested                       = true;
+            _wake.notify_all();
+            _drained.wait(lock, [this, target] { return _cycles >= target; });
+            return _failures == failures;
+        }
+
+        // Changes queued or being written.
+        [[nodiscard]] std::size_t pending() const
+        {
+            std::lock_guard<std::mutex> lock(_mtx);
+            return _queue.size() + _inFlight.size();
+        }
+
+        [[nodiscard]] std::uint64_t batches() const
+        {
+            std::lock_guard<std::mutex> lock(_mtx);
+            return _batches;
+        }
+
+        [[nodiscard]] std::uint64_t writeFailures() const
+        {
+            std::lock_guard<std::mutex> lock(_mtx);
+            return _failures;
+        }
+
+        // The cache's counters, with the loads performed here.
+        [[nodiscard]] stats::Snapshot stats() const noexcept
+        {
+            stats::Snapshot res = _cache.stats();
+            res += _stats.snapshot();
+            return res;
+        }
+
+        [[nodiscard]] Cache& cache() noexcept
+        {
+            return _cache;
+        }
+
+      private:
+        using Index = std::unordered_map<KeyType, std::size_t, Hash, Eq>;
+
+        // A concurrent put() wins over the loaded value, which may predate it.
+        bool load(const KeyType& key, ValType& cacheOut)
+        {
+            const auto             start = std::chrono::steady_clock::now();
+            std::optional<ValType> loaded;
+            try
+            {
+                loaded = _loader->load(key);
+            }
+            catch (...)
+            {
+                _stats.recordLoadFailure(std::chrono::steady_clock::now() - start);
+                throw;
+            }
+            if (!loaded)
+            {
+                _stats.recordLoadFailure(std::chrono::steady_clock::now() - start);
+                return false;
+            }
+            _stats.recordLoadSuccess(std::chrono::steady_clock::now() - start);
+            if (!_cache.putIfAbsent(key, *loaded) && _cache.get(key, cacheOut))
+            {
+                return true;
+            }
+            cacheOut = std::move(*loaded);
+            return true;
+        }
+
+        // The latest queued change to `key`, if any; a queued removal leaves `out` empty.
+        bool findQueued(const KeyType& key, std::optional<ValType>& out) const
+        {
+            std::lock_guard<std::mutex> lock(_mtx);
+            if (auto it = _index.find(key); it != _index.end())
+            {
+                out = _queue[it->second].value;
+                return true;
+            }
+            if (auto it = _inFlightIndex.find(key); it != _inFlightIndex.end())
+            {
+                out = _inFlight[it->second].value;
+                return true;
+            }
+            return false;
+        }
+
+        void stage(const KeyType& key, std::optional<ValType> value)
+        {
+            std::unique_lock<std::mutex> lock(_mtx);
+            auto                         it = _index.find(key);
+            if (it == _index.end() && _queue.size() >= _options.maxPending)
+            {
+                _wake.notify_all();
+                _drained.wait(lock, [this] { return _queue.size() < _options.maxPending; });
+                it = _index.find(key);
+            }
+            if (it != _index.end())
+            {
+                _queue[it->second].value = std::move(value);
+                return;
+            }
+            _queue.push_back(Change{key, std::move(value)});
+            try
+            {
+                _index.emplace(key, _queue.size() - 1);
+            }
+            catch (...)
+            {
+                _queue.pop_back();
+                throw;
+            }
+            if (_queue.size() == _options.batchSize)
+            {
+                lock.unlock();
+                _wake.notify_all();
+            }
+        }
+
+        void run()
+        {
+            std::unique_lock<std::mutex> lock(_mtx);
+            bool                         failed = false;
+            while (true)
+            {
+                // After a failure the store gets a full interval before the retry.
+                _wake.wait_for(lock, _options.interval,
+                               [this, failed] { return _stopping || _flushRequested || (!failed && _queue.size() >= _options.batchSize); });
+                const bool stopping = _stopping;
+                _flushRequested     = false;
+                if (!_queue.empty())
+                {
+                    _inFlight.swap(_queue);
+                    _inFlightIndex.swap(_index);
+                    _writing = true;
+                    lock.unlock();
+                    _drained.notify_all();
+                    const std::size_t written = writeInFlight();
+                    lock.lock();
+                    _writing = false;
+                    failed   = written < _inFlight.size();
+                    if (failed)
+                    {
+                        ++_failures;
+                        if (!stopping)
+                        {
+                            requeueUnlocked(written);
+                        }
+                    }
+                    _inFlight.clear();
+                    _inFlightIndex.clear();
+                }
+                ++_cycles;
+                _drained.notify_all();
+                if (stopping && (_queue.empty() || failed))
+                {
+                    return;
+                }
+            }
+        }
+
+        // Writes the batches in flight, outside the lock; returns how many changes were written.
+        std::size_t writeInFlight() noexcept
+        {
+            const std::span<const Change> changes(_inFlight);
+            std::size_t                   written = 0;
+            while (written < changes.size())
+            {
+                const std::size_t n = std::min(_options.batchSize, changes.size() - written);
+                try
+                {
+                    _writer->writeAll(changes.subspan(written, n));
+                }
+                catch (...)
+                {
+                    return written;
+                }
+                written += n;
+                std::lock_guard<std::mutex> lock(_mtx);
+                ++_batches;
+            }
+            return written;
+        }
+
+        // Queues the unwritten changes again, unless a newer change to the key was queued since.
+        void requeueUnlocked(std::size_t written) noexcept
+        {
+            for (std::size_t i = written; i < _inFlight.size(); ++i)
+            {
+                if (_index.contains(_inFlight[i].key))
+                {
+                    continue;
+                }
+                try
+                {
+                    _queue.push_back(std::move(_inFlight[i]));
+                    _index.emplace(_queue.back().key, _queue.size() - 1);
+                }
+                catch (...)
+                {
+                    return;
+                }
+            }
+        }
+
+        Cache&                      _cache;
+        std::shared_ptr<Loader>     _loader;
+        std::shared_ptr<Writer>     _writer;
+        const WriteMode             _mode;
+        const WriteBehind           _options;
+        [[no_unique_address]] Stats _stats;
+        mutable std::mutex          _mtx;
+        std::condition_variable     _wake;
+        std::condition_variable     _drained;
+        std::vector<Change>         _queue;
+        Index                       _index;
+        std::vector<Change>         _inFlight;
+        Index                       _inFlightIndex;
+        bool                        _writing        = false;
+        bool                        _flushRequested = false;
+        bool                        _stopping       = false;
+        std::uint64_t               _cycles         = 0;
+        std::uint64_t               _batches        = 0;
+        std::uint64_t               _failures       = 0;
+        std::thread                 _flusher;
+    };
+} // namespace cache::store
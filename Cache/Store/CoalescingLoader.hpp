@@ -0,0 +1,183 @@
+#pragma once
+
+#include <Cache/Store/Interfaces/ILoader.hpp>
+#include <chrono>
+#include <condition_variable>
+#include <cstddef>
+#include <cstdint>
+#include <exception>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <optional>
+#include <span>
+#include <stdexcept>
+#include <string>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+namespace cache::store
+{
+    struct Batching
+    {
+        // Keys per loadAll() call; a full batch is loaded at once.
+        std::size_t maxBatch = 64;
+        // How long the first miss of a batch waits for others to join it.
+        std::chrono::microseconds window = std::chrono::microseconds(200);
+    };
+
+    // Loader that combines concurrent load() calls into loadAll() calls on the wrapped one.
+    // The first miss opens a batch and waits up to `window` for others, or until `maxBatch`
+    // keys have joined, then loads them all in one call; every caller gets its own result,
+    // or the exception the bulk load threw. Callers asking for the same key share one slot.
+    // Plug it into Backed as its loader.
+    template <typename K, typename V, typename Hash = std::hash<K>, typename Eq = std::equal_to<K>>
+    class CoalescingLoader final : public ILoader<K, V>
+    {
+      public:
+        explicit CoalescingLoader(std::shared_ptr<ILoader<K, V>> loader, Batching batching = {}) : _loader(std::move(loader)), _batching(batching)
+        {
+            if (!_loader)
+            {
+                throw(std::invalid_argument("Cannot coalesce loads without a loader."));
+            }
+            if (_batching.maxBatch < 1)
+            {
+                throw(std::invalid_argument("Cannot give null batch size."));
+            }
+        }
+
+        [[nodiscard]] std::optional<V> load(const K& key) override
+        {
+            std::unique_lock<std::mutex> lock(_mtx);
+            std::shared_ptr<Batch>       batch  = _open;
+            const bool                   leader = !batch;
+            if (leader)
+            {
+                batch = std::make_shared<Batch>();
+                _open = batch;
+            }
+            std::size_t slot = 0;
+            try
+            {
+                slot = batch->join(key);
+            }
+            catch (...)
+            {
+                if (leader)
+                {
+                    _open.reset();
+                }
+                throw;
+            }
+            if (batch->keys.size() >= _batching.maxBatch)
+            {
+                close(batch);
+            }
+
+            if (leader)
+            {
+                batch->ready.wait_for(lock, _batching.window, [&batch] { return batch->closed; });
+                close(batch);
+                lock.unlock();
+                // Nobody joins a closed batch, so its keys can be read without the lock.
+                std::vector<std::optional<V>> results;
+                std::exception_ptr            error;
+                try
+                {
+                    results = _loader->loadAll(std::span<const K>(batch->keys));
+                    if (results.size() != batch->keys.size())
+                    {
+                        throw(std::length_error("loadAll() returned " + std::to_string(results.size()) + " results for " + std::to_string(batch->keys.size()) + " keys."));
+                    }
+                }
+                catch (...)
+                {
+                    error = std::current_exception();
+                }
+                lock.lock();
+                batch->results = std::move(results);
+                batch->error   = error;
+                batch->done    = true;
+                ++_batches;
+                batch->ready.notify_all();
+            }
+            else
+            {
+                batch->ready.wait(lock, [&batch] { return batch->done; });
+            }
+
+            if (batch->error)
+            {
+                std::rethrow_exception(batch->error);
+            }
+            return batch->results[slot];
+        }
+
+        // Already a batch: passed straight through.
+        [[nodiscard]] std::vector<std::optional<V>> loadAll(std::span<const K> keys) override
+        {
+            return _loader->loadAll(keys);
+        }
+
+        // loadAll() calls issued for coalesced load() calls.
+        [[nodiscard]] std::uint64_t batches() const
+        {
+            std::lock_guard<std::mutex> lock(_mtx);
+            return _batches;
+        }
+
+      private:
+        struct Batch
+        {
+            // Slot of `key` in the batch, adding it if it is new.
+            std::size_t join(const K& key)
+            {
+                if (auto it = index.find(key); it != index.end())
+                {
+                    return it->second;
+                }
+                keys.push_back(key);
+                try
+                {
+                    index.emplace(key, keys.size() - 1);
+                }
+                catch (...)
+                {
+                    keys.pop_back();
+                    throw;
+                }
+                return keys.size() - 1;
+            }
+
+            std::vector<K>                               keys;
+            std::unordered_map<K, std::size_t, Hash, Eq> index;
+            std::vector<std::optional<V>>                results;
+            std::exception_ptr                           error;
+            std::condition_variable                      ready;
+            bool                                         closed = false;
+            bool                                         done   = false;
+        };
+
+        // Stops `batch` from taking more keys and wakes its leader.
+        void close(const std::shared_ptr<Batch>& batch) noexcept
+        {
+            if (_open == batch)
+            {
+                _open.reset();
+            }
+            if (!batch->closed)
+            {
+                batch->closed = true;
+                batch->ready.notify_all();
+            }
+        }
+
+        std::shared_ptr<ILoader<K, V>> _loader;
+        const Batching                 _batching;
+        mutable std::mutex             _mtx;
+        std::shared_ptr<Batch>         _open;
+        std::uint64_t                  _batches = 0;
+    };
+} // namespace cache::store
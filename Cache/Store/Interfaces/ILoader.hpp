@@ -0,0 +1,39 @@
+#pragma once
+
+#include <Cache/Utils/NonCopyable.hpp>
+#include <optional>
+#include <span>
+#include <vector>
+
+namespace cache::store
+{
+    // Source a Backed cache reads through on a miss.
+    template <typename K, typename V>
+    class ILoader : public utils::NonCopyable
+    {
+      public:
+        using KeyType = K;
+        using ValType = V;
+
+        virtual ~ILoader() noexcept = default;
+
+        // The stored value, or nullopt when the store has none. May throw.
+        [[nodiscard]] virtual std::optional<V> load(const K& key) = 0;
+
+        // Loads several keys at once; result i belongs to keys[i]. Stores with a bulk API
+        // should override it.
+        [[nodiscard]] virtual std::vector<std::optional<V>> loadAll(std::span<const K> keys)
+        {
+            std::vector<std::optional<V>> res;
+            res.reserve(keys.size());
+            for (const auto& key : keys)
+            {
+                res.push_back(load(key));
+            }
+            return res;
+        }
+
+      protected:
+        constexpr explicit ILoader() = default;
+    };
+} // namespace cache::store
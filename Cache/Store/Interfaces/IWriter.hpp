@@ -0,0 +1,50 @@
+#pragma once
+
+#include <Cache/Utils/NonCopyable.hpp>
+#include <optional>
+#include <span>
+
+namespace cache::store
+{
+    // One pending change: the value to store, or nullopt to erase the key.
+    template <typename K, typename V>
+    struct Write
+    {
+        K                key;
+        std::optional<V> value;
+    };
+
+    // Sink a Backed cache writes changes to, one by one or in coalesced batches.
+    template <typename K, typename V>
+    class IWriter : public utils::NonCopyable
+    {
+      public:
+        using KeyType = K;
+        using ValType = V;
+
+        virtual ~IWriter() noexcept = default;
+
+        virtual void write(const K& key, const V& value) = 0;
+        virtual void erase(const K& key)                 = 0;
+
+        // Applies a batch holding at most one change per key. Stores with a bulk API should
+        // override it; a throw leaves the whole batch to be retried.
+        virtual void writeAll(std::span<const Write<K, V>> batch)
+        {
+            for (const auto& change : batch)
+            {
+                if (change.value)
+                {
+                    write(change.key, *change.value);
+                }
+                else
+                {
+                    erase(change.key);
+                }
+            }
+        }
+
+      protected:
+        constexpr explicit IWriter() = default;
+    };
+} // namespace cache::store
@@ -1,7 +1,12 @@
 #pragma once
 
+#include <Cache/Helpers/KeyHandle.hpp>
+#include <Cache/Memory/Arena.hpp>
+#include <Cache/Memory/CountingResource.hpp>
+#include <Cache/Memory/MemoryUsage.hpp>
 #include <Cache/Strategy/Interfaces/ACacheStrategy.hpp>
 #include <list>
+#include <memory_resource>
 #include <optional>
 #include <stdexcept>
 #include <unordered_map>
@@ -9,13 +14,17 @@
 namespace cache::strategy
 {
     template <typename K, typename V>
-    class TwoQueues final : public ACacheStrategy<K, V>
+    class TwoQueues final : public ACacheStrategy<TwoQueues<K, V>, K, V>
     {
+        friend class ACacheStrategy<TwoQueues<K, V>, K, V>;
+
       public:
-        TwoQueues()                            = default;
-        virtual ~TwoQueues() noexcept override = default;
+        explicit TwoQueues(std::pmr::memory_resource* upstream = std::pmr::get_default_resource()) : _memory(upstream)
+        { }
+
+        ~TwoQueues() noexcept = default;
 
-        virtual void onClear() noexcept override
+        void onClear() noexcept
         {
             _a1.clear();
             _am.clear();
@@ -23,7 +32,18 @@ namespace cache::strategy
             _posToAm.clear();
         }
 
-        [[nodiscard]] virtual bool onAccess(const K& key) override
+        // onClear() that also frees the index storage, leaving nothing allocated.
+        void release() noexcept
+        {
+            onClear();
+            memory::release(_am);
+            memory::release(_a1);
+            memory::release(_posToAm);
+            memory::release(_posToA1);
+            _capacity = 0;
+        }
+
+        [[nodiscard]] bool onAccess(const K& key)
         {
             if (auto it = _posToAm.find(key); it != _posToAm.end())
             {
@@ -32,23 +52,22 @@ namespace cache::strategy
             }
             if (auto it = _posToA1.find(key); it != _posToA1.end())
             {
-                _a1.erase(it->second);
+                _am.splice(_am.begin(), _a1, it->second);
+                _posToAm.emplace(it->first, _am.begin());
                 _posToA1.erase(it);
-                _am.push_front(key);
-                _posToAm.emplace(key, _am.begin());
                 return true;
             }
             return false;
         }
 
-        [[nodiscard]] virtual bool onInsert(const K& key) override
+        [[nodiscard]] bool onInsert(const K& key)
         {
-            _a1.push_front(key);
-            _posToA1.emplace(key, _a1.begin());
+            _a1.push_front(keys::handle(key));
+            _posToA1.emplace(keys::handle(key), _a1.begin());
             return true;
         }
 
-        [[nodiscard]] virtual bool onRemove(const K& key) override
+        [[nodiscard]] bool onRemove(const K& key)
         {
             if (auto it = _posToA1.find(key); it != _posToA1.end())
             {
@@ -64,38 +83,49 @@ namespace cache::strategy
             return true;
         }
 
-        [[nodiscard]] virtual std::optional<K> selectForEviction() override
+        [[nodiscard]] std::optional<K> selectForEviction()
         {
             if (!_a1.empty())
             {
-                return _a1.back();
+                return keys::get<K>(_a1.back());
             }
             if (!_am.empty())
             {
-                return _am.back();
+                return keys::get<K>(_am.back());
             }
             return std::nullopt;
         }
 
+        [[nodiscard]] memory::Usage memoryUsage() const noexcept
+        {
+            return memory::Usage{0, _memory.bytes(), _memory.blocks()};
+        }
+
       protected:
-        virtual void reserve_worker(std::size_t cap) override
+        void reserve_worker(std::size_t cap)
         {
             if (cap > _capacity)
             {
-                _capacity = cap;
-                _posToAm.reserve(_capacity);
-                _posToA1.reserve(_capacity);
+                _posToAm.reserve(cap);
+                _posToA1.reserve(cap);
+            }
+            else
+            {
+                memory::shrink(_posToAm, cap);
+                memory::shrink(_posToA1, cap);
             }
+            _capacity = cap;
         }
 
       private:
-        using ListType = std::list<K>;
-        using MapType  = std::unordered_map<K, typename ListType::iterator>;
+        using ListType = std::pmr::list<keys::Handle<K>>;
+        using MapType  = std::pmr::unordered_map<keys::Handle<K>, typename ListType::iterator, keys::Hash<K>, keys::Eq<K>>;
 
-        std::size_t _capacity = 0;
-        ListType    _am;
-        ListType    _a1;
-        MapType     _posToAm;
-        MapType     _posToA1;
+        std::size_t              _capacity = 0;
+        memory::CountingResource _memory;
+        ListType                 _am{&_memory};
+        ListType                 _a1{&_memory};
+        MapType                  _posToAm{&_memory};
+        MapType                  _posToA1{&_memory};
     };
 } // namespace cache::strategy
@@ -1,30 +1,55 @@
 #pragma once
 
+#include <Cache/Helpers/KeyHandle.hpp>
+#include <Cache/Memory/Arena.hpp>
+#include <Cache/Memory/CountingResource.hpp>
+#include <Cache/Memory/MemoryUsage.hpp>
 #include <Cache/Strategy/Interfaces/ACacheStrategy.hpp>
+#include <algorithm>
+#include <cstdint>
+#include <functional>
 #include <list>
+#include <memory_resource>
 #include <optional>
 #include <stdexcept>
 #include <unordered_map>
 #include <utility>
+#include <vector>
 
 namespace cache::strategy
 {
     template <typename K, typename V>
-    class HalvedLFU final : public ACacheStrategy<K, V>
+    class HalvedLFU final : public ACacheStrategy<HalvedLFU<K, V>, K, V>
     {
+        friend class ACacheStrategy<HalvedLFU<K, V>, K, V>;
+
       public:
-        HalvedLFU()                            = default;
-        virtual ~HalvedLFU() noexcept override = default;
+        explicit HalvedLFU(std::pmr::memory_resource* upstream = std::pmr::get_default_resource()) : _memory(upstream)
+        { }
+
+        ~HalvedLFU() noexcept = default;
 
-        virtual void onClear() noexcept override
+        void onClear() noexcept
         {
             _minFreq = 0;
             _keyToBucket.clear();
             _buckets.clear();
+            _pendingFreqs.clear();
+            _sweepCursor     = 0;
             _opsSinceHalving = 0;
         }
 
-        [[nodiscard]] virtual bool onAccess(const K& key) override
+        // onClear() that also frees the index storage, leaving nothing allocated.
+        void release() noexcept
+        {
+            onClear();
+            memory::release(_keyToBucket);
+            memory::release(_buckets);
+            memory::release(_pendingFreqs);
+            _capacity = 0;
+        }
+
+        [[nodiscard]] bool onAccess(const K& key)
         {
             checkHalving();
             auto keyIt = _keyToBucket.find(key);
@@ -33,42 +58,29 @@ namespace cache::strategy
                 return false;
             }
 
-            std::size_t freq   = keyIt->second.first;
-            auto        listIt = keyIt->second.second;
-
-            auto oldBucketIt = _buckets.find(freq);
+            std::size_t freq        = keyIt->second.freq;
+            auto        oldBucketIt = _buckets.find(freq);
             if (oldBucketIt == _buckets.end())
             {
                 return false;
             }
 
-            oldBucketIt->second.erase(listIt);
-            std::size_t newFreq = freq + 1;
-            if (oldBucketIt->second.empty())
-            {
-                _buckets.erase(oldBucketIt);
-                if (_minFreq == freq)
-                {
-                    _minFreq = newFreq;
-                }
-            }
-            auto& list = _buckets[newFreq];
-            list.push_front(key);
-            keyIt->second = {newFreq, list.begin()};
+            std::size_t newFreq = decayedFreq(keyIt->second) + 1;
+            moveToBucket(keyIt->second, oldBucketIt, newFreq);
             return true;
         }
 
-        [[nodiscard]] virtual bool onInsert(const K& key) override
+        [[nodiscard]] bool onInsert(const K& key)
         {
             checkHalving();
             auto& list = _buckets[1];
-            list.push_front(key);
-            _keyToBucket.emplace(key, PosType{1, list.begin()});
+            list.push_front(keys::handle(key));
+            _keyToBucket.emplace(keys::handle(key), PosType{1, _epoch, list.begin()});
             _minFreq = 1;
             return true;
         }
 
-        [[nodiscard]] virtual bool onRemove(const K& key) override
+        [[nodiscard]] bool onRemove(const K& key)
         {
             checkHalving();
             auto keyIt = _keyToBucket.find(key);
@@ -77,18 +89,18 @@ namespace cache::strategy
                 return false;
             }
 
-            std::size_t freq = keyIt->second.first;
+            std::size_t freq = keyIt->second.freq;
 
             auto oldBucketIt = _buckets.find(freq);
             if (oldBucketIt != _buckets.end())
             {
-                oldBucketIt->second.erase(keyIt->second.second);
+                oldBucketIt->second.erase(keyIt->second.it);
                 if (oldBucketIt->second.empty())
                 {
                     _buckets.erase(oldBucketIt);
                 }
             }
-            _keyToBucket.erase(key);
+            _keyToBucket.erase(keyIt);
             if (_keyToBucket.empty() || _buckets.empty())
             {
                 onClear();
@@ -96,7 +108,7 @@ namespace cache::strategy
             return true;
         }
 
-        [[nodiscard]] virtual std::optional<K> selectForEviction() override
+        [[nodiscard]] std::optional<K> selectForEviction()
         {
             if (_buckets.empty() || _minFreq == 0)
             {
@@ -122,103 +134,162 @@ namespace cache::strategy
                 _minFreq = *best;
                 bucketIt = _buckets.find(_minFreq);
             }
-            return bucketIt->second.back();
+            return keys::get<K>(bucketIt->second.back());
+        }
+
+        [[nodiscard]] memory::Usage memoryUsage() const noexcept
+        {
+            return memory::Usage{0, _memory.bytes(), _memory.blocks()};
         }
 
       protected:
-        virtual void reserve_worker(std::size_t cap) override
+        void reserve_worker(std::size_t cap)
         {
             if (cap > _capacity)
             {
-                _capacity = cap;
-                _keyToBucket.reserve(_capacity);
-                _buckets.reserve(_capacity);
+                _keyToBucket.reserve(cap);
+                _buckets.reserve(cap);
+            }
+            else
+            {
+                memory::shrink(_keyToBucket, cap);
+                memory::shrink(_buckets, cap);
             }
+            _capacity = cap;
         }
 
       private:
+        using ListType = std::pmr::list<keys::Handle<K>>;
+
+        struct PosType
+        {
+            std::size_t                 freq;
+            std::uint32_t               epoch;
+            typename ListType::iterator it;
+        };
+
+        using MapType    = std::pmr::unordered_map<keys::Handle<K>, PosType, keys::Hash<K>, keys::Eq<K>>;
+        using BucketType = std::pmr::unordered_map<std::size_t, ListType>;
+
+        // Halving is amortized: every period bumps `_epoch`, and a key's frequency is
+        // shifted right by the number of epochs it missed, either lazily when it is
+        // touched or by the bounded sweep in stepHalving(). The sweep goes up the
+        // frequencies; one cut short by the next period resumes at `_sweepCursor` and
+        // wraps around, so the high buckets are reached however large the cache.
         void checkHalving()
         {
-            if (++_opsSinceHalving < _halvingPeriod)
+            if (++_opsSinceHalving >= _halvingPeriod)
             {
-                return;
+                _opsSinceHalving = 0;
+                startHalving();
             }
-
-            if (_keyToBucket.empty())
+            if (!_pendingFreqs.empty())
             {
-                onClear();
-                return;
+                stepHalving();
             }
+        }
 
-            std::vector<Move> moves;
-            moves.reserve(_keyToBucket.size());
-
-            for (auto& kv : _keyToBucket)
+        void startHalving()
+        {
+            ++_epoch;
+            _pendingFreqs.clear();
+            _pendingFreqs.reserve(_buckets.size());
+            for (const auto& kv : _buckets)
             {
-                const K&    key     = kv.first;
-                std::size_t freq    = kv.second.first;
-                std::size_t newFreq = std::max<std::size_t>(1, freq / 2);
-                if (newFreq != freq)
+                if (kv.first > 1)
                 {
-                    moves.push_back({key, freq, newFreq});
+                    _pendingFreqs.push_back(kv.first);
                 }
             }
+            // Swept from the back: the frequencies from the cursor up in ascending order, then
+            // those below it.
+            const auto rank = [cursor = _sweepCursor](std::size_t freq) { return std::pair(freq < cursor, freq); };
+            std::sort(_pendingFreqs.begin(), _pendingFreqs.end(), [&rank](std::size_t a, std::size_t b) { return rank(a) > rank(b); });
+        }
 
-            for (const auto& m : moves)
+        void stepHalving()
+        {
+            std::size_t budget = _halvingBatch;
+            while (budget > 0 && !_pendingFreqs.empty())
             {
-                auto itKey = _keyToBucket.find(m.key);
-                if (itKey == _keyToBucket.end())
+                _sweepCursor  = _pendingFreqs.back();
+                auto bucketIt = _buckets.find(_sweepCursor);
+                if (bucketIt == _buckets.end())
                 {
+                    _pendingFreqs.pop_back();
                     continue;
                 }
 
-                auto itOldBucket = _buckets.find(m.oldFreq);
-                if (itOldBucket != _buckets.end())
+                // Keys touched since the epoch started were pushed to the front with the
+                // current epoch, so the stale ones always form the tail of the bucket.
+                auto& pos = _keyToBucket.find(bucketIt->second.back())->second;
+                if (pos.epoch == _epoch)
                 {
-                    itOldBucket->second.erase(itKey->second.second);
-                    if (itOldBucket->second.empty())
-                    {
-                        _buckets.erase(itOldBucket);
-                    }
+                    _pendingFreqs.pop_back();
+                    continue;
+                }
+                const bool lastInBucket = bucketIt->second.size() == 1;
+                moveToBucket(pos, bucketIt, decayedFreq(pos));
+                if (lastInBucket)
+                {
+                    _pendingFreqs.pop_back();
                 }
+                --budget;
+            }
+            if (_pendingFreqs.empty())
+            {
+                _sweepCursor = 0;
+            }
+        }
 
-                auto& list = _buckets[m.newFreq];
-                list.push_front(m.key);
-                itKey->second = PosType{m.newFreq, list.begin()};
+        [[nodiscard]] std::size_t decayedFreq(const PosType& pos) const noexcept
+        {
+            const std::uint32_t missed = _epoch - pos.epoch;
+            if (missed == 0)
+            {
+                return pos.freq;
+            }
+            if (missed >= sizeof(std::size_t) * 8)
+            {
+                return 1;
             }
+            return std::max<std::size_t>(1, pos.freq >> missed);
+        }
 
-            std::optional<std::size_t> best = std::nullopt;
-            for (const auto& kv : _buckets)
+        void moveToBucket(PosType& pos, typename BucketType::iterator oldBucketIt, std::size_t newFreq)
+        {
+            std::size_t freq    = pos.freq;
+            ListType&   oldList = oldBucketIt->second;
+            auto&       list    = _buckets[newFreq];
+            list.splice(list.begin(), oldList, pos.it);
+            pos.freq  = newFreq;
+            pos.epoch = _epoch;
+            if (oldList.empty())
             {
-                if (!kv.second.empty() && (!best || kv.first < *best))
+                _buckets.erase(freq);
+                if (_minFreq == freq)
                 {
-                    best = kv.first;
+                    _minFreq = newFreq;
                 }
             }
-            _minFreq = best ? *best : 0;
-
-            _opsSinceHalving = 0;
+            if (newFreq < _minFreq)
+            {
+                _minFreq = newFreq;
+            }
         }
 
-        using ListType   = std::list<K>;
-        using PosType    = std::pair<std::size_t, typename ListType::iterator>;
-        using MapType    = std::unordered_map<K, PosType>;
-        using BucketType = std::unordered_map<std::size_t, ListType>;
-
-        struct Move
-        {
-            K           key;
-            std::size_t oldFreq;
-            std::size_t newFreq;
-        };
-
         std::size_t _capacity = 0;
         std::size_t _minFreq  = 0;
 
-        MapType    _keyToBucket;
-        BucketType _buckets;
+        memory::CountingResource _memory;
+        MapType                  _keyToBucket{&_memory};
+        BucketType               _buckets{&_memory};
 
         static constexpr const std::size_t _halvingPeriod   = 4 * (1024);
+        static constexpr const std::size_t _halvingBatch    = 32;
         std::size_t                        _opsSinceHalving = 0;
+        std::uint32_t                      _epoch           = 0;
+        std::pmr::vector<std::size_t>      _pendingFreqs{&_memory};
+        std::size_t                        _sweepCursor     = 0;
     };
 } // namespace cache::strategy
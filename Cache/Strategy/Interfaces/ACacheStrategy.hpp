@@ -1,29 +1,29 @@
 #pragma once
 
-#include <Cache/Strategy/Interfaces/ICacheStrategy.hpp>
+#include <Cache/Utils/NonCopyable.hpp>
 #include <cstddef>
 #include <stdexcept>
 
 namespace cache::strategy
 {
-    template <typename K, typename V>
-    class ACacheStrategy : public ICacheStrategy<K, V>
+    template <typename Derived, typename K, typename V>
+    class ACacheStrategy : public utils::NonCopyable
     {
       public:
-        virtual ~ACacheStrategy() noexcept override = default;
+        using KeyType = K;
+        using ValType = V;
 
-        virtual void reserve(std::size_t cap) final override
+        void reserve(std::size_t cap)
         {
             if (cap < 1)
             {
                 throw(std::invalid_argument("Cannot give null capacity."));
             }
-            reserve_worker(cap);
+            static_cast<Derived&>(*this).reserve_worker(cap);
         }
 
       protected:
-        virtual void reserve_worker(std::size_t cap) = 0;
-
         constexpr explicit ACacheStrategy() = default;
+        ~ACacheStrategy() noexcept          = default;
     };
 } // namespace cache::strategy
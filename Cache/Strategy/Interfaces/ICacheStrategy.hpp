@@ -5,6 +5,9 @@
 
 namespace cache::strategy
 {
+    // Keys passed in need not outlive the call: implementations copy whatever key they keep.
+    // (The strategies themselves may borrow keys, see keys::Handle; StrategyAdapter owns
+    // copies for them.)
     template <typename K, typename V>
     class ICacheStrategy : public utils::NonCopyable
     {
@@ -0,0 +1,86 @@
+#pragma once
+
+#include <Cache/Concepts/CacheConcepts.hpp>
+#include <Cache/Helpers/KeyHandle.hpp>
+#include <Cache/Strategy/Interfaces/ICacheStrategy.hpp>
+#include <optional>
+#include <type_traits>
+#include <unordered_set>
+
+namespace cache::strategy
+{
+    // Exposes a strategy through ICacheStrategy. Strategies borrow non-trivial keys (see
+    // keys::Handle), which ICacheStrategy callers are not required to keep alive, so the
+    // adapter keeps its own copy of each inserted key and hands that one to the strategy.
+    template <typename S>
+        requires concepts::StrategyLike<S, typename S::KeyType, typename S::ValType>
+    class StrategyAdapter final : public ICacheStrategy<typename S::KeyType, typename S::ValType>
+    {
+      public:
+        using KeyType = typename S::KeyType;
+        using ValType = typename S::ValType;
+
+        StrategyAdapter()                            = default;
+        virtual ~StrategyAdapter() noexcept override = default;
+
+        virtual void onClear() noexcept override
+        {
+            _strategy.onClear();
+            _keys.clear();
+        }
+
+        [[nodiscard]] virtual bool onAccess(const KeyType& key) override
+        {
+            return _strategy.onAccess(key);
+        }
+
+        [[nodiscard]] virtual bool onInsert(const KeyType& key) override
+        {
+            if constexpr (_owning)
+            {
+                return _strategy.onInsert(*_keys.insert(key).first);
+            }
+            else
+            {
+                return _strategy.onInsert(key);
+            }
+        }
+
+        [[nodiscard]] virtual bool onRemove(const KeyType& key) override
+        {
+            if constexpr (_owning)
+            {
+                // The strategy lets go of the adapter's copy before it is freed.
+                const bool detached = _strategy.onRemove(key);
+                _keys.erase(key);
+                return detached;
+            }
+            else
+            {
+                return _strategy.onRemove(key);
+            }
+        }
+
+        virtual void reserve(std::size_t cap) override
+        {
+            _strategy.reserve(cap);
+        }
+
+        [[nodiscard]] virtual std::optional<KeyType> selectForEviction() override
+        {
+            return _strategy.selectForEviction();
+        }
+
+      private:
+        static constexpr bool _owning = keys::borrowed<KeyType>;
+
+        struct NoKeys
+        {
+            void clear() noexcept
+            { }
+        };
+
+        S                                                                _strategy;
+        std::conditional_t<_owning, std::unordered_set<KeyType>, NoKeys> _keys;
+    };
+} // namespace cache::strategy
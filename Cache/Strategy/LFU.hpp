@@ -1,7 +1,12 @@
 #pragma once
 
+#include <Cache/Helpers/KeyHandle.hpp>
+#include <Cache/Memory/Arena.hpp>
+#include <Cache/Memory/CountingResource.hpp>
+#include <Cache/Memory/MemoryUsage.hpp>
 #include <Cache/Strategy/Interfaces/ACacheStrategy.hpp>
 #include <list>
+#include <memory_resource>
 #include <optional>
 #include <stdexcept>
 #include <unordered_map>
@@ -10,137 +15,166 @@
 namespace cache::strategy
 {
     template <typename K, typename V>
-    class LFU final : public ACacheStrategy<K, V>
+    class LFU final : public ACacheStrategy<LFU<K, V>, K, V>
     {
+        friend class ACacheStrategy<LFU<K, V>, K, V>;
+
       public:
-        LFU()                            = default;
-        virtual ~LFU() noexcept override = default;
+        explicit LFU(std::pmr::memory_resource* upstream = std::pmr::get_default_resource()) : _memory(upstream)
+        { }
+
+        ~LFU() noexcept = default;
+
+        void onClear() noexcept
+        {
+            _keyToPos.clear();
+            _freqs.clear();
+            _freePool.clear();
+            _spareKeys.clear();
+        }
 
-        virtual void onClear() noexcept override
+        // onClear() that also frees the index storage, leaving nothing allocated.
+        void release() noexcept
         {
-            _minFreq = 0;
-            _keyToBucket.clear();
-            _buckets.clear();
+            onClear();
+            memory::release(_keyToPos);
+            memory::release(_freqs);
+            memory::release(_freePool);
+            memory::release(_spareKeys);
+            _capacity = 0;
         }
 
-        [[nodiscard]] virtual bool onAccess(const K& key) override
+        [[nodiscard]] bool onAccess(const K& key)
         {
-            auto keyIt = _keyToBucket.find(key);
-            if (keyIt == _keyToBucket.end())
+            auto keyIt = _keyToPos.find(key);
+            if (keyIt == _keyToPos.end())
             {
                 return false;
             }
 
-            std::size_t freq   = keyIt->second.first;
-            auto        listIt = keyIt->second.second;
-
-            auto oldBucketIt = _buckets.find(freq);
-            if (oldBucketIt == _buckets.end())
+            auto node = keyIt->second.node;
+            auto next = std::next(node);
+            if (next == _freqs.end() || next->freq != node->freq + 1)
             {
-                return false;
+                next = acquireNode(next, node->freq + 1);
             }
-
-            oldBucketIt->second.erase(listIt);
-            std::size_t newFreq = freq + 1;
-            if (oldBucketIt->second.empty())
+            next->keys.splice(next->keys.begin(), node->keys, keyIt->second.it);
+            keyIt->second.node = next;
+            if (node->keys.empty())
             {
-                _buckets.erase(oldBucketIt);
-                if (_minFreq == freq)
-                {
-                    _minFreq = newFreq;
-                }
+                releaseNode(node);
             }
-            auto& list = _buckets[newFreq];
-            list.push_front(key);
-            keyIt->second = {newFreq, list.begin()};
             return true;
         }
 
-        [[nodiscard]] virtual bool onInsert(const K& key) override
+        [[nodiscard]] bool onInsert(const K& key)
         {
-            auto& list = _buckets[1];
-            list.push_front(key);
-            _keyToBucket.emplace(key, PosType{1, list.begin()});
-            _minFreq = 1;
+            auto node = _freqs.begin();
+            if (node == _freqs.end() || node->freq != 1)
+            {
+                node = acquireNode(node, 1);
+            }
+            if (_spareKeys.empty())
+            {
+                node->keys.push_front(keys::handle(key));
+            }
+            else
+            {
+                node->keys.splice(node->keys.begin(), _spareKeys, _spareKeys.begin());
+                node->keys.front() = keys::handle(key);
+            }
+            _keyToPos.emplace(keys::handle(key), PosType{node, node->keys.begin()});
             return true;
         }
 
-        [[nodiscard]] virtual bool onRemove(const K& key) override
+        [[nodiscard]] bool onRemove(const K& key)
         {
-            auto keyIt = _keyToBucket.find(key);
-            if (keyIt == _keyToBucket.end())
+            auto keyIt = _keyToPos.find(key);
+            if (keyIt == _keyToPos.end())
             {
                 return false;
             }
 
-            std::size_t freq = keyIt->second.first;
-
-            auto oldBucketIt = _buckets.find(freq);
-            if (oldBucketIt != _buckets.end())
+            auto node = keyIt->second.node;
+            _spareKeys.splice(_spareKeys.begin(), node->keys, keyIt->second.it);
+            if (node->keys.empty())
             {
-                oldBucketIt->second.erase(keyIt->second.second);
-                if (oldBucketIt->second.empty())
-                {
-                    _buckets.erase(oldBucketIt);
-                }
-            }
-            _keyToBucket.erase(key);
-            if (_keyToBucket.empty() || _buckets.empty())
-            {
-                onClear();
+                releaseNode(node);
             }
+            _keyToPos.erase(keyIt);
             return true;
         }
 
-        [[nodiscard]] virtual std::optional<K> selectForEviction() override
+        [[nodiscard]] std::optional<K> selectForEviction()
         {
-            if (_buckets.empty() || _minFreq == 0)
+            if (_freqs.empty())
             {
                 return std::nullopt;
             }
+            return keys::get<K>(_freqs.front().keys.back());
+        }
 
-            auto bucketIt = _buckets.find(_minFreq);
-            if (bucketIt == _buckets.end() || bucketIt->second.empty())
-            {
-                std::optional<std::size_t> best = std::nullopt;
-                for (const auto& kv : _buckets)
-                {
-                    if (!kv.second.empty() && (!best || kv.first < *best))
-                    {
-                        best = kv.first;
-                    }
-                }
-                if (!best)
-                {
-                    return std::nullopt;
-                }
-                _minFreq = *best;
-                bucketIt = _buckets.find(_minFreq);
-            }
-            return bucketIt->second.back();
+        [[nodiscard]] memory::Usage memoryUsage() const noexcept
+        {
+            return memory::Usage{0, _memory.bytes(), _memory.blocks()};
         }
 
       protected:
-        virtual void reserve_worker(std::size_t cap) override
+        void reserve_worker(std::size_t cap)
         {
             if (cap > _capacity)
             {
-                _capacity = cap;
-                _keyToBucket.reserve(_capacity);
-                _buckets.reserve(_capacity);
+                _keyToPos.reserve(cap);
             }
+            else
+            {
+                memory::shrink(_keyToPos, cap);
+            }
+            _capacity = cap;
         }
 
       private:
-        using ListType   = std::list<K>;
-        using PosType    = std::pair<std::size_t, typename ListType::iterator>;
-        using MapType    = std::unordered_map<K, PosType>;
-        using BucketType = std::unordered_map<std::size_t, ListType>;
+        using ListType = std::pmr::list<keys::Handle<K>>;
+
+        struct FreqNode
+        {
+            std::size_t freq;
+            ListType    keys;
+        };
+
+        using FreqList = std::pmr::list<FreqNode>;
+
+        struct PosType
+        {
+            typename FreqList::iterator node;
+            typename ListType::iterator it;
+        };
+
+        using MapType = std::pmr::unordered_map<keys::Handle<K>, PosType, keys::Hash<K>, keys::Eq<K>>;
+
+        typename FreqList::iterator acquireNode(typename FreqList::iterator before, std::size_t freq)
+        {
+            if (_freePool.empty())
+            {
+                return _freqs.insert(before, FreqNode{freq, ListType(&_memory)});
+            }
+            _freqs.splice(before, _freePool, _freePool.begin());
+            auto node  = std::prev(before);
+            node->freq = freq;
+            return node;
+        }
+
+        void releaseNode(typename FreqList::iterator node)
+        {
+            _freePool.splice(_freePool.begin(), _freqs, node);
+        }
 
         std::size_t _capacity = 0;
-        std::size_t _minFreq  = 0;
 
-        MapType    _keyToBucket;
-        BucketType _buckets;
+        memory::CountingResource _memory;
+        MapType                  _keyToPos{&_memory};
+        FreqList                 _freqs{&_memory};
+        FreqList                 _freePool{&_memory};
+        ListType                 _spareKeys{&_memory};
     };
 } // namespace cache::strategy
@@ -1,7 +1,12 @@
 #pragma once
 
+#include <Cache/Helpers/KeyHandle.hpp>
+#include <Cache/Memory/Arena.hpp>
+#include <Cache/Memory/CountingResource.hpp>
+#include <Cache/Memory/MemoryUsage.hpp>
 #include <Cache/Strategy/Interfaces/ACacheStrategy.hpp>
 #include <list>
+#include <memory_resource>
 #include <optional>
 #include <stdexcept>
 #include <unordered_map>
@@ -9,19 +14,32 @@
 namespace cache::strategy
 {
     template <typename K, typename V>
-    class LRU final : public ACacheStrategy<K, V>
+    class LRU final : public ACacheStrategy<LRU<K, V>, K, V>
     {
+        friend class ACacheStrategy<LRU<K, V>, K, V>;
+
       public:
-        LRU()                            = default;
-        virtual ~LRU() noexcept override = default;
+        explicit LRU(std::pmr::memory_resource* upstream = std::pmr::get_default_resource()) : _memory(upstream)
+        { }
+
+        ~LRU() noexcept = default;
 
-        virtual void onClear() noexcept override
+        void onClear() noexcept
         {
             _accessOrder.clear();
             _keyToIterator.clear();
         }
 
-        [[nodiscard]] virtual bool onAccess(const K& key) override
+        // onClear() that also frees the index storage, leaving nothing allocated.
+        void release() noexcept
+        {
+            onClear();
+            memory::release(_accessOrder);
+            memory::release(_keyToIterator);
+            _capacity = 0;
+        }
+
+        [[nodiscard]] bool onAccess(const K& key)
         {
             auto it = _keyToIterator.find(key);
             if (it == _keyToIterator.end())
@@ -32,14 +50,14 @@ namespace cache::strategy
             return true;
         }
 
-        [[nodiscard]] virtual bool onInsert(const K& key) override
+        [[nodiscard]] bool onInsert(const K& key)
         {
-            _accessOrder.push_front(key);
-            _keyToIterator.emplace(key, _accessOrder.begin());
+            _accessOrder.push_front(keys::handle(key));
+            _keyToIterator.emplace(keys::handle(key), _accessOrder.begin());
             return true;
         }
 
-        [[nodiscard]] virtual bool onRemove(const K& key) override
+        [[nodiscard]] bool onRemove(const K& key)
         {
             auto it = _keyToIterator.find(key);
             if (it != _keyToIterator.end())
@@ -50,31 +68,41 @@ namespace cache::strategy
             return true;
         }
 
-        [[nodiscard]] virtual std::optional<K> selectForEviction() override
+        [[nodiscard]] std::optional<K> selectForEviction()
         {
             if (_accessOrder.empty())
             {
                 return std::nullopt;
             }
-            return _accessOrder.back();
+            return keys::get<K>(_accessOrder.back());
+        }
+
+        [[nodiscard]] memory::Usage memoryUsage() const noexcept
+        {
+            return memory::Usage{0, _memory.bytes(), _memory.blocks()};
         }
 
       protected:
-        virtual void reserve_worker(std::size_t cap) override
+        void reserve_worker(std::size_t cap)
         {
             if (cap > _capacity)
             {
-                _capacity = cap;
-                _keyToIterator.reserve(_capacity);
+                _keyToIterator.reserve(cap);
+            }
+            else
+            {
+                memory::shrink(_keyToIterator, cap);
             }
+            _capacity = cap;
         }
 
       private:
-        using ListType = std::list<K>;
-        using MapType  = std::unordered_map<K, typename ListType::iterator>;
+        using ListType = std::pmr::list<keys::Handle<K>>;
+        using MapType  = std::pmr::unordered_map<keys::Handle<K>, typename ListType::iterator, keys::Hash<K>, keys::Eq<K>>;
 
-        std::size_t _capacity = 0;
-        ListType    _accessOrder;
-        MapType     _keyToIterator;
+        std::size_t              _capacity = 0;
+        memory::CountingResource _memory;
+        ListType                 _accessOrder{&_memory};
+        MapType                  _keyToIterator{&_memory};
     };
 } // namespace cache::strategy
@@ -1,9 +1,14 @@
 #pragma once
 
+#include <Cache/Helpers/KeyHandle.hpp>
+#include <Cache/Memory/Arena.hpp>
+#include <Cache/Memory/CountingResource.hpp>
+#include <Cache/Memory/MemoryUsage.hpp>
 #include <Cache/Strategy/Interfaces/ACacheStrategy.hpp>
 #include <chrono>
 #include <cstdint>
 #include <list>
+#include <memory_resource>
 #include <optional>
 #include <random>
 #include <stdexcept>
@@ -12,34 +17,46 @@
 namespace cache::strategy
 {
     template <typename K, typename V>
-    class RedisLFU final : public ACacheStrategy<K, V>
+    class RedisLFU final : public ACacheStrategy<RedisLFU<K, V>, K, V>
     {
+        friend class ACacheStrategy<RedisLFU<K, V>, K, V>;
+
       public:
-        explicit RedisLFU() : _rng(std::random_device{}())
+        explicit RedisLFU(std::pmr::memory_resource* upstream = std::pmr::get_default_resource()) : _memory(upstream), _rng(std::random_device{}())
         { }
 
-        virtual ~RedisLFU() noexcept override = default;
+        ~RedisLFU() noexcept = default;
 
-        virtual void onClear() noexcept override
+        void onClear() noexcept
         {
             _meta.clear();
             _pos.clear();
             _index.clear();
         }
 
-        [[nodiscard]] virtual bool onInsert(const K& key) override
+        // onClear() that also frees the index storage, leaving nothing allocated.
+        void release() noexcept
+        {
+            onClear();
+            memory::release(_meta);
+            memory::release(_index);
+            memory::release(_pos);
+            _capacity = 0;
+        }
+
+        [[nodiscard]] bool onInsert(const K& key)
         {
             if (_pos.find(key) != _pos.end())
             {
                 return false;
             }
-            _index.push_front(key);
-            _pos.emplace(key, _index.begin());
-            _meta[key] = LFUMeta{0, currentMinutes()};
+            _index.push_front(keys::handle(key));
+            _pos.emplace(keys::handle(key), _index.begin());
+            _meta.insert_or_assign(keys::handle(key), LFUMeta{0, currentMinutes()});
             return true;
         }
 
-        [[nodiscard]] virtual bool onAccess(const K& key) override
+        [[nodiscard]] bool onAccess(const K& key)
         {
             auto pit = _pos.find(key);
             if (pit == _pos.end())
@@ -57,14 +74,17 @@ namespace cache::strategy
             return true;
         }
 
-        [[nodiscard]] virtual bool onRemove(const K& key) override
+        [[nodiscard]] bool onRemove(const K& key)
         {
             if (auto it = _pos.find(key); it != _pos.end())
             {
                 _index.erase(it->second);
                 _pos.erase(it);
             }
-            _meta.erase(key);
+            if (auto it = _meta.find(key); it != _meta.end())
+            {
+                _meta.erase(it);
+            }
             if (_pos.empty() != _meta.empty())
             {
                 return false;
@@ -72,7 +92,7 @@ namespace cache::strategy
             return true;
         }
 
-        [[nodiscard]] virtual std::optional<K> selectForEviction() override
+        [[nodiscard]] std::optional<K> selectForEviction()
         {
             if (_index.empty())
             {
@@ -84,12 +104,10 @@ namespace cache::strategy
 
             for (std::size_t i = 0; i < _sampleSize && it != _index.end(); ++i)
             {
-                const K& key = *it;
+                lfuDecayOnAccess(keys::get<K>(*it));
 
-                lfuDecayOnAccess(key);
-
-                const auto& m = _meta[key];
-                Candidate   c{key, m.hits, m.ldt, it};
+                const auto& m = _meta.try_emplace(*it).first->second;
+                Candidate   c{*it, m.hits, m.ldt, it};
 
                 if (!worst || isWorse(c, *worst))
                 {
@@ -107,14 +125,28 @@ namespace cache::strategy
             {
                 return std::nullopt;
             }
-            return worst->key;
+            return keys::get<K>(worst->key);
+        }
+
+        [[nodiscard]] memory::Usage memoryUsage() const noexcept
+        {
+            return memory::Usage{0, _memory.bytes(), _memory.blocks()};
         }
 
       protected:
-        virtual void reserve_worker(std::size_t cap) override
+        void reserve_worker(std::size_t cap)
         {
-            _meta.reserve(cap);
-            _pos.reserve(cap);
+            if (cap > _capacity)
+            {
+                _meta.reserve(cap);
+                _pos.reserve(cap);
+            }
+            else
+            {
+                memory::shrink(_meta, cap);
+                memory::shrink(_pos, cap);
+            }
+            _capacity = cap;
         }
 
       private:
@@ -124,12 +156,16 @@ namespace cache::strategy
             std::uint16_t ldt  = 0;
         };
 
+        using IndexType = std::pmr::list<keys::Handle<K>>;
+        using MetaType  = std::pmr::unordered_map<keys::Handle<K>, LFUMeta, keys::Hash<K>, keys::Eq<K>>;
+        using PosType   = std::pmr::unordered_map<keys::Handle<K>, typename IndexType::iterator, keys::Hash<K>, keys::Eq<K>>;
+
         struct Candidate
         {
-            K                               key;
-            std::uint8_t                    hits;
-            std::uint16_t                   ldt;
-            typename std::list<K>::iterator idxIt;
+            keys::Handle<K>              key;
+            std::uint8_t                 hits;
+            std::uint16_t                ldt;
+            typename IndexType::iterator idxIt;
         };
 
         static bool isWorse(const Candidate& a, const Candidate& b)
@@ -176,7 +212,12 @@ namespace cache::strategy
 
         void lfuMaybeIncrement(const K& key, std::uint32_t rnd32)
         {
-            auto& m = _meta[key];
+            auto it = _meta.find(key);
+            if (it == _meta.end())
+            {
+                return;
+            }
+            auto& m = it->second;
             if (m.hits == 255)
             {
                 return;
@@ -194,10 +235,12 @@ namespace cache::strategy
         static constexpr const std::uint8_t  _lfuLogFactor = 10;
         static constexpr const std::uint16_t _lfuDecayTime = 1;
 
-        std::unordered_map<K, LFUMeta> _meta;
+        std::size_t              _capacity = 0;
+        memory::CountingResource _memory;
+        MetaType                 _meta{&_memory};
 
-        std::list<K>                                           _index;
-        std::unordered_map<K, typename std::list<K>::iterator> _pos;
+        IndexType _index{&_memory};
+        PosType   _pos{&_memory};
 
         std::mt19937                                 _rng;
         std::uniform_int_distribution<std::uint32_t> _dist;
@@ -1,7 +1,12 @@
 #pragma once
 
+#include <Cache/Helpers/KeyHandle.hpp>
+#include <Cache/Memory/Arena.hpp>
+#include <Cache/Memory/CountingResource.hpp>
+#include <Cache/Memory/MemoryUsage.hpp>
 #include <Cache/Strategy/Interfaces/ACacheStrategy.hpp>
 #include <list>
+#include <memory_resource>
 #include <optional>
 #include <stdexcept>
 #include <unordered_map>
@@ -9,13 +14,17 @@
 namespace cache::strategy
 {
     template <typename K, typename V>
-    class SLRU final : public ACacheStrategy<K, V>
+    class SLRU final : public ACacheStrategy<SLRU<K, V>, K, V>
     {
+        friend class ACacheStrategy<SLRU<K, V>, K, V>;
+
       public:
-        SLRU()                    = default;
-        ~SLRU() noexcept override = default;
+        explicit SLRU(std::pmr::memory_resource* upstream = std::pmr::get_default_resource()) : _memory(upstream)
+        { }
+
+        ~SLRU() noexcept = default;
 
-        virtual void onClear() noexcept override
+        void onClear() noexcept
         {
             _prob.clear();
             _prot.clear();
@@ -23,14 +32,25 @@ namespace cache::strategy
             _posProt.clear();
         }
 
-        [[nodiscard]] virtual bool onInsert(const K& key) override
+        // onClear() that also frees the index storage, leaving nothing allocated.
+        void release() noexcept
+        {
+            onClear();
+            memory::release(_prob);
+            memory::release(_prot);
+            memory::release(_posProb);
+            memory::release(_posProt);
+            _capacity = 0;
+        }
+
+        [[nodiscard]] bool onInsert(const K& key)
         {
-            _prob.push_front(key);
-            _posProb.emplace(key, _prob.begin());
+            _prob.push_front(keys::handle(key));
+            _posProb.emplace(keys::handle(key), _prob.begin());
             return true;
         }
 
-        [[nodiscard]] virtual bool onAccess(const K& key) override
+        [[nodiscard]] bool onAccess(const K& key)
         {
             if (auto it = _posProt.find(key); it != _posProt.end())
             {
@@ -39,17 +59,16 @@ namespace cache::strategy
             }
             if (auto it = _posProb.find(key); it != _posProb.end())
             {
-                _prob.erase(it->second);
+                _prot.splice(_prot.begin(), _prob, it->second);
+                _posProt.emplace(it->first, _prot.begin());
                 _posProb.erase(it);
-                _prot.push_front(key);
-                _posProt.emplace(key, _prot.begin());
                 enforceProtectedCap();
                 return true;
             }
             return false;
         }
 
-        [[nodiscard]] virtual bool onRemove(const K& key) override
+        [[nodiscard]] bool onRemove(const K& key)
         {
             if (auto it = _posProb.find(key); it != _posProb.end())
             {
@@ -65,29 +84,40 @@ namespace cache::strategy
             return true;
         }
 
-        [[nodiscard]] virtual std::optional<K> selectForEviction() override
+        [[nodiscard]] std::optional<K> selectForEviction()
         {
             if (!_prob.empty())
             {
-                return _prob.back();
+                return keys::get<K>(_prob.back());
             }
             if (!_prot.empty())
             {
-                return _prot.back();
+                return keys::get<K>(_prot.back());
             }
             return std::nullopt;
         }
 
+        [[nodiscard]] memory::Usage memoryUsage() const noexcept
+        {
+            return memory::Usage{0, _memory.bytes(), _memory.blocks()};
+        }
+
       protected:
-        virtual void reserve_worker(std::size_t cap) override
+        void reserve_worker(std::size_t cap)
         {
             if (cap > _capacity)
             {
-                _capacity = cap;
-                _posProb.reserve(_capacity);
-                _posProt.reserve(_capacity);
+                _posProb.reserve(cap);
+                _posProt.reserve(cap);
+            }
+            else
+            {
+                memory::shrink(_posProb, cap);
+                memory::shrink(_posProt, cap);
             }
-            _protCap = (_capacity == 0) ? 0 : std::max<std::size_t>(1, static_cast<std::size_t>(_protRatio * static_cast<double>(_capacity)));
+            _capacity = cap;
+            _protCap  = (_capacity == 0) ? 0 : std::max<std::size_t>(1, static_cast<std::size_t>(_protRatio * static_cast<double>(_capacity)));
+            enforceProtectedCap();
         }
 
       private:
@@ -95,24 +125,23 @@ namespace cache::strategy
         {
             while (_protCap > 0 && _prot.size() > _protCap)
             {
-                const K& demoteKey = _prot.back();
-                auto     it        = _posProt.find(demoteKey);
-                _prot.pop_back();
+                auto it = _posProt.find(_prot.back());
+                _prob.splice(_prob.begin(), _prot, std::prev(_prot.end()));
                 _posProt.erase(it);
-                _prob.push_front(demoteKey);
-                _posProb.emplace(demoteKey, _prob.begin());
+                _posProb.emplace(_prob.front(), _prob.begin());
             }
         }
 
-        using ListType = std::list<K>;
-        using MapType  = std::unordered_map<K, typename ListType::iterator>;
+        using ListType = std::pmr::list<keys::Handle<K>>;
+        using MapType  = std::pmr::unordered_map<keys::Handle<K>, typename ListType::iterator, keys::Hash<K>, keys::Eq<K>>;
 
-        std::size_t  _capacity  = 0;
-        std::size_t  _protCap   = 0;
-        const double _protRatio = 0.67;
-        ListType     _prob;
-        ListType     _prot;
-        MapType      _posProb;
-        MapType      _posProt;
+        std::size_t              _capacity  = 0;
+        std::size_t              _protCap   = 0;
+        const double             _protRatio = 0.67;
+        memory::CountingResource _memory;
+        ListType                 _prob{&_memory};
+        ListType                 _prot{&_memory};
+        MapType                  _posProb{&_memory};
+        MapType                  _posProt{&_memory};
     };
 } // namespace cache::strategy
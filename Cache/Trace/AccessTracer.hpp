@@ -0,0 +1,319 @@
+#pragma once
+
+#include <Cache/Helpers/Hashing.hpp>
+#include <Cache/Utils/NonCopyable.hpp>
+#include <algorithm>
+#include <atomic>
+#include <bit>
+#include <chrono>
+#include <cmath>
+#include <condition_variable>
+#include <cstdint>
+#include <cstring>
+#include <fstream>
+#include <limits>
+#include <memory>
+#include <mutex>
+#include <stdexcept>
+#include <string>
+#include <thread>
+#include <unordered_map>
+#include <vector>
+
+namespace cache::trace
+{
+    enum class Op : std::uint8_t
+    {
+        GET    = 0,
+        PUT    = 1,
+        REMOVE = 2
+    };
+
+    struct Record
+    {
+        std::uint64_t timestampNs; // since the tracer started
+        std::uint64_t keyHash;
+        std::uint32_t valueSize;
+        Op            op;
+        std::uint8_t  hit;
+        std::uint16_t thread;
+    };
+
+    static_assert(sizeof(Record) == 24);
+
+    // File layout: one FileHeader followed by packed, native-endian Records.
+    struct FileHeader
+    {
+        char          magic[8]   = {'C', 'T', 'R', 'A', 'C', 'E', '0', '1'};
+        std::uint32_t version    = 1;
+        std::uint32_t recordSize = sizeof(Record);
+        std::uint64_t startUnixNs{0};
+        double        sampleRate{1.0};
+    };
+
+    static_assert(sizeof(FileHeader) == 32);
+
+    template <typename V>
+    [[nodiscard]] std::uint32_t valueSize(const V& value) noexcept
+    {
+        std::size_t size = sizeof(V);
+        if constexpr (requires { value.size(); typename V::value_type; })
+        {
+            size = value.size() * sizeof(typename V::value_type);
+        }
+        return static_cast<std::uint32_t>(std::min<std::size_t>(size, std::numeric_limits<std::uint32_t>::max()));
+    }
+
+    // Records sampled cache accesses into per-thread SPSC rings; a background thread drains
+    // them to a binary file. Sampling is decided on the key hash, so a sampled key keeps its
+    // whole access history. A full ring drops records rather than blocking the cache.
+    class AccessTracer : public utils::NonCopyable
+    {
+      public:
+        explicit AccessTracer(const std::string& path, double sampleRate = 1.0, std::size_t ringCapacity = 16384,
+                              std::chrono::milliseconds flushInterval = std::chrono::milliseconds(10))
+            : _out(path, std::ios::binary | std::ios::trunc), _ringCapacity(std::bit_ceil(std::max<std::size_t>(2, ringCapacity))),
+              _flushInterval(flushInterval), _start(std::chrono::steady_clock::now())
+        {
+            if (!_out)
+            {
+                throw(std::invalid_argument("Cannot open trace file: " + path));
+            }
+            if (!(sampleRate >= 0.0 && sampleRate <= 1.0))
+            {
+                throw(std::invalid_argument("Sample rate must be in [0, 1]."));
+            }
+            // 2^64 itself does not fit the threshold: a full rate samples everything instead.
+            _sampleAll = sampleRate == 1.0;
+            if (!_sampleAll)
+            {
+                _threshold = static_cast<std::uint64_t>(std::ldexp(sampleRate, 64));
+            }
+
+            FileHeader header;
+            header.startUnixNs = static_cast<std::uint64_t>(std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::system_clock::now().time_since_epoch()).count());
+            header.sampleRate  = sampleRate;
+            _out.write(reinterpret_cast<const char*>(&header), sizeof(header));
+
+            _flusher = std::thread([this] { flushLoop(); });
+        }
+
+        ~AccessTracer() noexcept
+        {
+            stop();
+        }
+
+        [[nodiscard]] bool sampled(std::uint64_t keyHash) const noexcept
+        {
+            return _sampleAll || hashing::mix(keyHash, hashing::seed) < _threshold;
+        }
+
+        void record(Op op, std::uint64_t keyHash, std::uint32_t valueSize, bool hit) noexcept
+        {
+            if (!sampled(keyHash) || _stopped.load(std::memory_order_relaxed))
+            {
+                return;
+            }
+            Ring* ring = localRing();
+            if (!ring)
+            {
+                return;
+            }
+            const auto ts = static_cast<std::uint64_t>(std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now() - _start).count());
+            ring->push(Record{ts, keyHash, valueSize, op, static_cast<std::uint8_t>(hit), ring->thread});
+        }
+
+        // Drains every ring, flushes and closes the file. Further records are ignored.
+        void stop() noexcept
+        {
+            {
+                std::lock_guard<std::mutex> lock(_flushMtx);
+                if (_stopped.exchange(true))
+                {
+                    return;
+                }
+            }
+            _flushCv.notify_all();
+            if (_flusher.joinable())
+            {
+                _flusher.join();
+            }
+            drainAll();
+            _out.flush();
+            _out.close();
+        }
+
+        [[nodiscard]] std::uint64_t written() const noexcept
+        {
+            return _written.load(std::memory_order_relaxed);
+        }
+
+        [[nodiscard]] std::uint64_t dropped() const noexcept
+        {
+            std::lock_guard<std::mutex> lock(_ringsMtx);
+            std::uint64_t               res = 0;
+            for (const auto& ring : _rings)
+            {
+                res += ring->dropped.load(std::memory_order_relaxed);
+            }
+            return res;
+        }
+
+      private:
+        struct Ring
+        {
+            Ring(std::size_t capacity, std::uint16_t threadIndex) : slots(capacity), mask(capacity - 1), thread(threadIndex)
+            { }
+
+            void push(const Record& r) noexcept
+            {
+                const std::uint64_t h = head.load(std::memory_order_relaxed);
+                if (h - tail.load(std::memory_order_acquire) > mask)
+                {
+                    dropped.fetch_add(1, std::memory_order_relaxed);
+                    return;
+                }
+                slots[h & mask] = r;
+                head.store(h + 1, std::memory_order_release);
+            }
+
+            void drain(std::vector<Record>& out)
+            {
+                std::uint64_t       t = tail.load(std::memory_order_relaxed);
+                const std::uint64_t h = head.load(std::memory_order_acquire);
+                for (; t < h; ++t)
+                {
+                    out.push_back(slots[t & mask]);
+                }
+                tail.store(t, std::memory_order_release);
+            }
+
+            std::vector<Record>                    slots;
+            const std::uint64_t                    mask;
+            const std::uint16_t                    thread;
+            alignas(64) std::atomic<std::uint64_t> head{0};
+            alignas(64) std::atomic<std::uint64_t> tail{0};
+            std::atomic<std::uint64_t>             dropped{0};
+        };
+
+        [[nodiscard]] Ring* localRing() noexcept
+        {
+            thread_local std::uint64_t cachedOwner = 0;
+            thread_local Ring*         cachedRing  = nullptr;
+            if (cachedOwner == _id)
+            {
+                return cachedRing;
+            }
+            try
+            {
+                std::lock_guard<std::mutex> lock(_ringsMtx);
+                auto&                       ring = _byThread[std::this_thread::get_id()];
+                if (!ring)
+                {
+                    _rings.push_back(std::make_unique<Ring>(_ringCapacity, static_cast<std::uint16_t>(_rings.size())));
+                    ring = _rings.back().get();
+                }
+                cachedOwner = _id;
+                cachedRing  = ring;
+                return ring;
+            }
+            catch (...)
+            {
+                return nullptr;
+            }
+        }
+
+        void flushLoop()
+        {
+            std::unique_lock<std::mutex> lock(_flushMtx);
+            while (!_stopped.load())
+            {
+                _flushCv.wait_for(lock, _flushInterval, [this] { return _stopped.load(); });
+                lock.unlock();
+                drainAll();
+                lock.lock();
+            }
+        }
+
+        void drainAll() noexcept
+        {
+            std::vector<Ring*> rings;
+            {
+                std::lock_guard<std::mutex> lock(_ringsMtx);
+                rings.reserve(_rings.size());
+                for (auto& ring : _rings)
+                {
+                    rings.push_back(ring.get());
+                }
+            }
+            try
+            {
+                std::lock_guard<std::mutex> lock(_writeMtx);
+                for (auto* ring : rings)
+                {
+                    _buffer.clear();
+                    ring->drain(_buffer);
+                    if (!_buffer.empty() && _out.is_open())
+                    {
+                        _out.write(reinterpret_cast<const char*>(_buffer.data()), static_cast<std::streamsize>(_buffer.size() * sizeof(Record)));
+                        _written.fetch_add(_buffer.size(), std::memory_order_relaxed);
+                    }
+                }
+            }
+            catch (...)
+            {
+            }
+        }
+
+        [[nodiscard]] static std::uint64_t nextId() noexcept
+        {
+            static std::atomic<std::uint64_t> ids{0};
+            return ++ids;
+        }
+
+        const std::uint64_t                         _id        = nextId();
+        std::ofstream                               _out;
+        const std::size_t                           _ringCapacity;
+        const std::chrono::milliseconds             _flushInterval;
+        const std::chrono::steady_clock::time_point _start;
+        bool                                        _sampleAll = true;
+        std::uint64_t                               _threshold = 0;
+
+        mutable std::mutex                         _ringsMtx;
+        std::vector<std::unique_ptr<Ring>>         _rings;
+        std::unordered_map<std::thread::id, Ring*> _byThread;
+
+        std::mutex                 _writeMtx;
+        std::vector<Record>        _buffer;
+        std::atomic<std::uint64_t> _written{0};
+
+        std::mutex              _flushMtx;
+        std::condition_variable _flushCv;
+        std::atomic<bool>       _stopped{false};
+        std::thread             _flusher;
+    };
+
+    // Reads back a file produced by AccessTracer.
+    [[nodiscard]] inline std::vector<Record> readTraceFile(const std::string& path)
+    {
+        std::ifstream in(path, std::ios::binary);
+        if (!in)
+        {
+            throw(std::invalid_argument("Cannot open trace file: " + path));
+        }
+        FileHeader header;
+        FileHeader expected;
+        if (!in.read(reinterpret_cast<char*>(&header), sizeof(header)) || std::memcmp(header.magic, expected.magic, sizeof(header.magic)) != 0 ||
+            header.recordSize != sizeof(Record))
+        {
+            throw(std::invalid_argument("Not an access trace: " + path));
+        }
+        std::vector<Record> records;
+        Record              r{};
+        while (in.read(reinterpret_cast<char*>(&r), sizeof(r)))
+        {
+            records.push_back(r);
+        }
+        return records;
+    }
+} // namespace cache::trace
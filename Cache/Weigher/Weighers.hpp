@@ -0,0 +1,52 @@
+#pragma once
+
+#include <Cache/Memory/MemoryUsage.hpp>
+#include <cstddef>
+#include <type_traits>
+
+namespace cache::weigher
+{
+    // Every entry weighs 1: the capacity is an entry count.
+    struct Unit
+    {
+        static constexpr bool unit = true;
+
+        template <typename K, typename V>
+        [[nodiscard]] constexpr std::size_t operator()(const K&, const V&) const noexcept
+        {
+            return 1;
+        }
+    };
+
+    // Approximate heap footprint of a value: its own size plus the buffer allocated by
+    // containers (std::string, std::vector, ...), see memory::heapBytes().
+    template <typename T>
+    [[nodiscard]] std::size_t bytesOf(const T& value) noexcept
+    {
+        return sizeof(T) + memory::heapBytes(value);
+    }
+
+    // Weighs an entry by the bytes of its key and value: the capacity is a memory budget.
+    struct ByteSize
+    {
+        static constexpr bool unit = false;
+
+        template <typename K, typename V>
+        [[nodiscard]] std::size_t operator()(const K& key, const V& value) const noexcept
+        {
+            return bytesOf(key) + bytesOf(value);
+        }
+    };
+
+    template <typename W>
+    inline constexpr bool isUnit = [] {
+        if constexpr (requires { W::unit; })
+        {
+            return static_cast<bool>(W::unit);
+        }
+        else
+        {
+            return false;
+        }
+    }();
+} // namespace cache::weigher
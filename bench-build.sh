@@ -0,0 +1,19 @@
+#!/bin/bash
+
+set -u
+set -o pipefail
+
+# Builds and runs every benchmarks/*_bench.cpp; each one prints CSV after a
+# "[BENCH] <file>" marker. Results are also written to bench_output.txt.
+
+output_file="bench_output.txt"
+bench_bin=$(mktemp)
+trap 'rm -f "$bench_bin"' EXIT
+
+# shellcheck disable=SC2016
+if ! find ./benchmarks -maxdepth 1 -type f -name '*_bench.cpp' -print0 \
+    | sort -z -udf \
+    | xargs -0 -n1 sh -c 'printf "\n[BENCH] %s\n" "$1"; g++ "$1" -I . --std=c++20 -O2 -DNDEBUG -pthread -o "$0" && "$0"' "$bench_bin" \
+    | tee "$output_file"; then
+    exit 84
+fi
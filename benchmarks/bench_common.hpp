@@ -0,0 +1,142 @@
+// Shared helpers for the benchmarks: timing, allocation counting and CSV output.
+// Each benchmark is built as a single translation unit, so the replacement
+// allocation functions below are defined exactly once per binary.
+#pragma once
+
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <new>
+#include <string>
+
+namespace bench
+{
+    inline std::atomic<std::uint64_t> allocations{0};
+
+    struct Measurement
+    {
+        double nsPerOp;
+        double allocsPerOp;
+    };
+
+    struct Result
+    {
+        std::string container;
+        std::string strategy;
+        std::string key;
+        std::string value;
+        std::size_t capacity;
+        std::string op;
+        Measurement measurement;
+    };
+
+    template <typename T>
+    inline void doNotOptimize(const T& value)
+    {
+        asm volatile("" : : "r,m"(value) : "memory");
+    }
+
+    // Runs `rounds` rounds of `ops` calls to body(n), n counting across rounds. setup(round)
+    // runs before each round and is neither timed nor counted.
+    template <typename Setup, typename Body>
+    [[nodiscard]] Measurement measure(std::size_t rounds, std::size_t ops, Setup&& setup, Body&& body)
+    {
+        std::chrono::nanoseconds elapsed{0};
+        std::uint64_t            allocs = 0;
+        for (std::size_t r = 0; r < rounds; ++r)
+        {
+            setup(r);
+            const std::uint64_t allocsBefore = allocations.load(std::memory_order_relaxed);
+            const auto          start        = std::chrono::steady_clock::now();
+            for (std::size_t i = 0; i < ops; ++i)
+            {
+                body(r * ops + i);
+            }
+            elapsed += std::chrono::steady_clock::now() - start;
+            allocs += allocations.load(std::memory_order_relaxed) - allocsBefore;
+        }
+        const double total = static_cast<double>(rounds * ops);
+        return {static_cast<double>(elapsed.count()) / total, static_cast<double>(allocs) / total};
+    }
+
+    inline void printHeader()
+    {
+        std::printf("container,strategy,key,value,capacity,op,ns_per_op,allocs_per_op\n");
+    }
+
+    inline void print(const Result& r)
+    {
+        std::printf("%s,%s,%s,%s,%zu,%s,%.2f,%.3f\n", r.container.c_str(), r.strategy.c_str(), r.key.c_str(), r.value.c_str(), r.capacity, r.op.c_str(),
+                    r.measurement.nsPerOp, r.measurement.allocsPerOp);
+        std::fflush(stdout);
+    }
+} // namespace bench
+
+// The whole set of replaceable forms is provided, so that every new and delete agrees on
+// malloc() and free(). The deallocation functions are kept out of line: inlined, GCC sees
+// free() called on the result of operator new and warns (-Wmismatched-new-delete).
+namespace bench
+{
+    inline void* countedAlloc(std::size_t size) noexcept
+    {
+        allocations.fetch_add(1, std::memory_order_relaxed);
+        return std::malloc(size ? size : 1);
+    }
+} // namespace bench
+
+void* operator new(std::size_t size)
+{
+    if (void* p = bench::countedAlloc(size))
+    {
+        return p;
+    }
+    throw std::bad_alloc();
+}
+
+void* operator new[](std::size_t size)
+{
+    return operator new(size);
+}
+
+void* operator new(std::size_t size, const std::nothrow_t&) noexcept
+{
+    return bench::countedAlloc(size);
+}
+
+void* operator new[](std::size_t size, const std::nothrow_t&) noexcept
+{
+    return bench::countedAlloc(size);
+}
+
+[[gnu::noinline]] void operator delete(void* p) noexcept
+{
+    std::free(p);
+}
+
+[[gnu::noinline]] void operator delete[](void* p) noexcept
+{
+    std::free(p);
+}
+
+[[gnu::noinline]] void operator delete(void* p, std::size_t) noexcept
+{
+    std::free(p);
+}
+
+[[gnu::noinline]] void operator delete[](void* p, std::size_t) noexcept
+{
+    std::free(p);
+}
+
+[[gnu::noinline]] void operator delete(void* p, const std::nothrow_t&) noexcept
+{
+    std::free(p);
+}
+
+[[gnu::noinline]] void operator delete[](void* p, const std::nothrow_t&) noexcept
+{
+    std::free(p);
+}
@@ -0,0 +1,158 @@
+// Single-threaded micro-benchmarks: ns/op and allocations/op of the basic operations
+// for every strategy, container, key/value size and capacity.
+#include "bench_common.hpp"
+#include <Cache/Base.hpp>
+#include <Cache/Fragmented.hpp>
+#include <Cache/Shared.hpp>
+#include <Cache/SharedFragmented.hpp>
+#include <Cache/Strategy/2Q.hpp>
+#include <Cache/Strategy/FIFO.hpp>
+#include <Cache/Strategy/HalvedLFU.hpp>
+#include <Cache/Strategy/LFU.hpp>
+#include <Cache/Strategy/LRU.hpp>
+#include <Cache/Strategy/MRU.hpp>
+#include <Cache/Strategy/RedisLFU.hpp>
+#include <Cache/Strategy/SLRU.hpp>
+#include <algorithm>
+#include <array>
+#include <string>
+#include <vector>
+
+namespace
+{
+    constexpr std::size_t minOps    = 200000;
+    constexpr std::size_t fragments = 4;
+
+    template <std::size_t N>
+    struct Blob
+    {
+        std::array<char, N> bytes{};
+    };
+
+    template <typename T>
+    struct TypeName;
+
+    template <>
+    struct TypeName<int>
+    {
+        static constexpr const char* value = "int";
+    };
+
+    template <>
+    struct TypeName<std::string>
+    {
+        static constexpr const char* value = "string32";
+    };
+
+    template <>
+    struct TypeName<Blob<256>>
+    {
+        static constexpr const char* value = "blob256";
+    };
+
+    // A distinct hasher per capacity gives every Shared/SharedFragmented singleton its own instance.
+    template <typename K, std::size_t Cap>
+    struct BenchHash : std::hash<K>
+    { };
+
+    template <typename K>
+    std::vector<K> makeKeys(std::size_t n)
+    {
+        std::vector<K> keys;
+        keys.reserve(n);
+        for (std::size_t i = 0; i < n; ++i)
+        {
+            if constexpr (std::is_same_v<K, std::string>)
+            {
+                std::string id = std::to_string(i);
+                keys.push_back(std::string(32 - id.size(), 'k') + id);
+            }
+            else
+            {
+                keys.push_back(static_cast<K>(i));
+            }
+        }
+        return keys;
+    }
+
+    template <typename Cache, typename K, typename V>
+    void runOps(const char* container, const char* strategy, Cache& cache, const std::vector<K>& keys)
+    {
+        const std::size_t cap    = cache.capacity();
+        const std::size_t rounds = std::max<std::size_t>(1, minOps / cap);
+        const V           value{};
+        V                 out{};
+
+        auto fill = [&]
+        {
+            cache.clear();
+            for (std::size_t i = 0; i < cap; ++i)
+            {
+                cache.put(keys[i], value);
+            }
+        };
+        auto report = [&](const char* op, bench::Measurement m)
+        {
+            bench::print({container, strategy, TypeName<K>::value, TypeName<V>::value, cap, op, m});
+        };
+
+        report("put_insert", bench::measure(rounds, cap, [&](std::size_t) { cache.clear(); }, [&](std::size_t n) { cache.put(keys[n % cap], value); }));
+        report("get_hit", bench::measure(rounds, cap, [&](std::size_t) {}, [&](std::size_t n) { bench::doNotOptimize(cache.get(keys[n % cap], out)); }));
+        report("get_miss", bench::measure(rounds, cap, [&](std::size_t) {}, [&](std::size_t n) { bench::doNotOptimize(cache.get(keys[cap + n % cap], out)); }));
+        report("remove", bench::measure(rounds, cap, [&](std::size_t) { fill(); }, [&](std::size_t n) { cache.remove(keys[n % cap]); }));
+        report("put_evict", bench::measure(rounds, cap, [&](std::size_t r) { if (r == 0) fill(); }, [&](std::size_t n) { cache.put(keys[cap + n], value); }));
+        cache.clear();
+    }
+
+    template <template <typename, typename> class S, typename K, typename V, std::size_t Cap>
+    void benchContainers(const char* strategy)
+    {
+        using Strategy = S<K, V>;
+        using Hash     = BenchHash<K, Cap>;
+
+        const std::size_t rounds = std::max<std::size_t>(1, minOps / Cap);
+        const auto        keys   = makeKeys<K>(Cap + rounds * Cap);
+
+        {
+            cache::Base<K, V, Strategy, Hash> c(Cap);
+            runOps<decltype(c), K, V>("Base", strategy, c, keys);
+        }
+        {
+            cache::Fragmented<K, V, Strategy, Hash> c(fragments, Cap);
+            runOps<decltype(c), K, V>("Fragmented", strategy, c, keys);
+        }
+        {
+            auto& c = cache::Shared<K, V, Strategy, Hash>::getInstance();
+            c.initialize(Cap);
+            runOps<std::remove_reference_t<decltype(c)>, K, V>("Shared", strategy, c, keys);
+        }
+        {
+            auto& c = cache::SharedFragmented<K, V, Strategy, Hash>::getInstance();
+            c.initialize(fragments, Cap);
+            runOps<std::remove_reference_t<decltype(c)>, K, V>("SharedFragmented", strategy, c, keys);
+        }
+    }
+
+    template <template <typename, typename> class S>
+    void benchStrategy(const char* strategy)
+    {
+        benchContainers<S, int, int, 1024>(strategy);
+        benchContainers<S, int, int, 65536>(strategy);
+        benchContainers<S, std::string, Blob<256>, 1024>(strategy);
+        benchContainers<S, std::string, Blob<256>, 65536>(strategy);
+    }
+} // namespace
+
+int main()
+{
+    bench::printHeader();
+    benchStrategy<cache::strategy::LRU>("LRU");
+    benchStrategy<cache::strategy::MRU>("MRU");
+    benchStrategy<cache::strategy::FIFO>("FIFO");
+    benchStrategy<cache::strategy::LFU>("LFU");
+    benchStrategy<cache::strategy::HalvedLFU>("HalvedLFU");
+    benchStrategy<cache::strategy::RedisLFU>("RedisLFU");
+    benchStrategy<cache::strategy::SLRU>("SLRU");
+    benchStrategy<cache::strategy::TwoQueues>("2Q");
+    return 0;
+}
@@ -0,0 +1,365 @@
+// Multi-threaded scalability benchmark: throughput and tail latency of every container
+// and mutex combination for several key distributions, read/write mixes and thread counts.
+//
+// Options (all optional, `name=value`):
+//   threads=N      highest thread count (default: hardware concurrency); runs 1, 2, 4, ..., N
+//   capacity=N     cache capacity (default 65536)
+//   keys=N         key space size (default 4 * capacity)
+//   fragments=N    fragment count for the fragmented containers (default 16)
+//   seconds=S      duration of each configuration (default 0.2)
+//   read=P[,P...]  read percentages (default 95,50)
+//   dist=D[,D...]  uniform, zipf, hotspot (default all)
+//   skew=S         Zipfian exponent (default 0.99)
+//   hot=K:O        hotspot: fraction K of the keys receives fraction O of the ops (default 0.2:0.8)
+#include <Cache/Base.hpp>
+#include <Cache/Fragmented.hpp>
+#include <Cache/Shared.hpp>
+#include <Cache/SharedFragmented.hpp>
+#include <Cache/Stats/CacheStats.hpp>
+#include <Cache/Strategy/LRU.hpp>
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cmath>
+#include <cstdint>
+#include <cstdio>
+#include <mutex>
+#include <random>
+#include <shared_mutex>
+#include <sstream>
+#include <stdexcept>
+#include <string>
+#include <thread>
+#include <vector>
+
+#ifdef __linux__
+    #include <pthread.h>
+    #include <sched.h>
+#endif
+
+namespace
+{
+    using K = std::uint64_t;
+    using V = std::uint64_t;
+
+    constexpr std::size_t traceSize = std::size_t{1} << 20;
+
+    struct Options
+    {
+        std::size_t              maxThreads = std::max(1U, std::thread::hardware_concurrency());
+        std::size_t              capacity   = 65536;
+        std::size_t              keys       = 0;
+        std::size_t              fragments  = 16;
+        double                   seconds    = 0.2;
+        std::vector<int>         readPcts   = {95, 50};
+        std::vector<std::string> dists      = {"uniform", "zipf", "hotspot"};
+        double                   skew       = 0.99;
+        double                   hotKeys    = 0.2;
+        double                   hotOps     = 0.8;
+    };
+
+    std::vector<std::string> split(const std::string& s, char sep)
+    {
+        std::vector<std::string> res;
+        std::stringstream        ss(s);
+        std::string              item;
+        while (std::getline(ss, item, sep))
+        {
+            res.push_back(item);
+        }
+        return res;
+    }
+
+    Options parseOptions(int argc, char** argv)
+    {
+        Options opts;
+        for (int i = 1; i < argc; ++i)
+        {
+            const std::string arg = argv[i];
+            const auto        eq  = arg.find('=');
+            if (eq == std::string::npos)
+            {
+                throw(std::invalid_argument("Expected name=value, got: " + arg));
+            }
+            const std::string name  = arg.substr(0, eq);
+            const std::string value = arg.substr(eq + 1);
+            if (name == "threads")
+            {
+                opts.maxThreads = std::stoul(value);
+            }
+            else if (name == "capacity")
+            {
+                opts.capacity = std::stoul(value);
+            }
+            else if (name == "keys")
+            {
+                opts.keys = std::stoul(value);
+            }
+            else if (name == "fragments")
+            {
+                opts.fragments = std::stoul(value);
+            }
+            else if (name == "seconds")
+            {
+                opts.seconds = std::stod(value);
+            }
+            else if (name == "skew")
+            {
+                opts.skew = std::stod(value);
+            }
+            else if (name == "dist")
+            {
+                opts.dists = split(value, ',');
+            }
+            else if (name == "read")
+            {
+                opts.readPcts.clear();
+                for (const auto& p : split(value, ','))
+                {
+                    opts.readPcts.push_back(std::stoi(p));
+                }
+            }
+            else if (name == "hot")
+            {
+                const auto parts = split(value, ':');
+                if (parts.size() != 2)
+                {
+                    throw(std::invalid_argument("Expected hot=K:O"));
+                }
+                opts.hotKeys = std::stod(parts[0]);
+                opts.hotOps  = std::stod(parts[1]);
+            }
+            else
+            {
+                throw(std::invalid_argument("Unknown option: " + name));
+            }
+        }
+        if (opts.keys == 0)
+        {
+            opts.keys = 4 * opts.capacity;
+        }
+        return opts;
+    }
+
+    // Key sequences are generated up front so the generator cost stays out of the measurement.
+    std::vector<K> makeTrace(const std::string& dist, const Options& opts)
+    {
+        std::mt19937_64 rng(42);
+        std::vector<K>  trace(traceSize);
+        if (dist == "uniform")
+        {
+            std::uniform_int_distribution<K> pick(0, opts.keys - 1);
+            std::generate(trace.begin(), trace.end(), [&] { return pick(rng); });
+        }
+        else if (dist == "zipf")
+        {
+            std::vector<double> cdf(opts.keys);
+            double              sum = 0;
+            for (std::size_t i = 0; i < opts.keys; ++i)
+            {
+                sum += 1.0 / std::pow(static_cast<double>(i + 1), opts.skew);
+                cdf[i] = sum;
+            }
+            std::uniform_real_distribution<double> u(0, sum);
+            std::generate(trace.begin(), trace.end(), [&] { return static_cast<K>(std::lower_bound(cdf.begin(), cdf.end(), u(rng)) - cdf.begin()); });
+        }
+        else if (dist == "hotspot")
+        {
+            const K                                hot = std::max<K>(1, static_cast<K>(opts.hotKeys * static_cast<double>(opts.keys)));
+            std::uniform_real_distribution<double> u(0, 1);
+            std::uniform_int_distribution<K>       pickHot(0, hot - 1);
+            std::uniform_int_distribution<K>       pickCold(std::min<K>(hot, opts.keys - 1), opts.keys - 1);
+            std::generate(trace.begin(), trace.end(), [&] { return u(rng) < opts.hotOps ? pickHot(rng) : pickCold(rng); });
+        }
+        else
+        {
+            throw(std::invalid_argument("Unknown distribution: " + dist));
+        }
+        return trace;
+    }
+
+    void pinToCore(std::size_t core)
+    {
+#ifdef __linux__
+        cpu_set_t set;
+        CPU_ZERO(&set);
+        CPU_SET(core % std::max(1U, std::thread::hardware_concurrency()), &set);
+        (void) pthread_setaffinity_np(pthread_self(), sizeof(set), &set);
+#else
+        (void) core;
+#endif
+    }
+
+    struct alignas(64) ThreadResult
+    {
+        std::uint64_t           ops   = 0;
+        std::uint64_t           reads = 0;
+        std::uint64_t           hits  = 0;
+        cache::stats::Histogram latency;
+    };
+
+    template <typename Cache>
+    void runConfig(Cache& cache, const char* container, const char* mutexes, const Options& opts, const std::string& dist, const std::vector<K>& trace,
+                   int readPct, std::size_t threads)
+    {
+        cache.clear();
+        for (K k = 0; k < opts.capacity; ++k)
+        {
+            cache.put(k, k);
+        }
+
+        std::atomic<std::size_t>  ready{0};
+        std::atomic<bool>         start{false};
+        std::atomic<bool>         stop{false};
+        std::vector<ThreadResult> results(threads);
+        std::vector<std::thread>  workers;
+        workers.reserve(threads);
+
+        for (std::size_t t = 0; t < threads; ++t)
+        {
+            workers.emplace_back(
+                [&, t]
+                {
+                    pinToCore(t);
+                    ThreadResult& res = results[t];
+                    std::size_t   pos = t * (traceSize / threads);
+                    std::uint64_t rng = 0x9E3779B97F4A7C15ULL * (t + 1);
+                    V             out{};
+                    ready.fetch_add(1);
+                    while (!start.load(std::memory_order_acquire))
+                    {
+                        std::this_thread::yield();
+                    }
+                    while (!stop.load(std::memory_order_relaxed))
+                    {
+                        const K key = trace[pos];
+                        pos         = (pos + 1) & (traceSize - 1);
+                        rng ^= rng << 13;
+                        rng ^= rng >> 7;
+                        rng ^= rng << 17;
+
+                        const auto begin = std::chrono::steady_clock::now();
+                        if (static_cast<int>(rng % 100) < readPct)
+                        {
+                            res.hits += cache.get(key, out) ? 1 : 0;
+                            ++res.reads;
+                        }
+                        else
+                        {
+                            cache.put(key, key);
+                        }
+                        const auto elapsed = std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now() - begin);
+                        ++res.latency.counts[cache::stats::Histogram::bucketFor(static_cast<std::uint64_t>(elapsed.count()))];
+                        ++res.ops;
+                    }
+                });
+        }
+
+        while (ready.load() != threads)
+        {
+            std::this_thread::yield();
+        }
+        const auto begin = std::chrono::steady_clock::now();
+        start.store(true, std::memory_order_release);
+        std::this_thread::sleep_for(std::chrono::duration<double>(opts.seconds));
+        stop.store(true, std::memory_order_relaxed);
+        for (auto& w : workers)
+        {
+            w.join();
+        }
+        const double elapsed = std::chrono::duration<double>(std::chrono::steady_clock::now() - begin).count();
+
+        ThreadResult total;
+        for (const auto& r : results)
+        {
+            total.ops += r.ops;
+            total.reads += r.reads;
+            total.hits += r.hits;
+            total.latency += r.latency;
+        }
+        std::printf("%s,%s,%zu,%s,%d,%zu,%.3f,%.3f,%lld,%lld,%lld\n", container, mutexes, opts.fragments, dist.c_str(), readPct, threads,
+                    static_cast<double>(total.ops) / elapsed / 1e6, total.reads ? static_cast<double>(total.hits) / static_cast<double>(total.reads) : 0.0,
+                    static_cast<long long>(total.latency.percentile(0.5).count()), static_cast<long long>(total.latency.percentile(0.99).count()),
+                    static_cast<long long>(total.latency.percentile(0.999).count()));
+        std::fflush(stdout);
+    }
+
+    template <typename Cache>
+    void runAll(Cache& cache, const char* container, const char* mutexes, const Options& opts, const std::vector<std::pair<std::string, std::vector<K>>>& traces)
+    {
+        for (const auto& [dist, trace] : traces)
+        {
+            for (int readPct : opts.readPcts)
+            {
+                for (std::size_t threads = 1;; threads = std::min(threads * 2, opts.maxThreads))
+                {
+                    runConfig(cache, container, mutexes, opts, dist, trace, readPct, threads);
+                    if (threads == opts.maxThreads)
+                    {
+                        break;
+                    }
+                }
+            }
+        }
+        cache.clear();
+    }
+
+    template <typename Mutex, typename InnerMutex = Mutex>
+    using FragmentedType = cache::Fragmented<K, V, cache::strategy::LRU<K, V>, std::hash<K>, std::equal_to<K>, Mutex, InnerMutex>;
+
+    template <typename Mutex>
+    using SharedType = cache::Shared<K, V, cache::strategy::LRU<K, V>, std::hash<K>, std::equal_to<K>, Mutex>;
+
+    template <typename FragmentMutex>
+    using SharedFragmentedType = cache::SharedFragmented<K, V, cache::strategy::LRU<K, V>, std::hash<K>, std::equal_to<K>, std::shared_mutex, std::shared_mutex, FragmentMutex>;
+} // namespace
+
+int main(int argc, char** argv)
+{
+    const Options opts = parseOptions(argc, argv);
+
+    std::vector<std::pair<std::string, std::vector<K>>> traces;
+    for (const auto& dist : opts.dists)
+    {
+        traces.emplace_back(dist, makeTrace(dist, opts));
+    }
+
+    std::printf("container,mutexes,fragments,distribution,read_pct,threads,mops,hit_ratio,p50_ns,p99_ns,p999_ns\n");
+    {
+        cache::Base<K, V, cache::strategy::LRU<K, V>, std::hash<K>, std::equal_to<K>, std::shared_mutex> c(opts.capacity);
+        runAll(c, "Base", "shared_mutex", opts, traces);
+    }
+    {
+        cache::Base<K, V, cache::strategy::LRU<K, V>, std::hash<K>, std::equal_to<K>, std::mutex> c(opts.capacity);
+        runAll(c, "Base", "mutex", opts, traces);
+    }
+    {
+        FragmentedType<std::shared_mutex> c(opts.fragments, opts.capacity);
+        runAll(c, "Fragmented", "shared_mutex/shared_mutex", opts, traces);
+    }
+    {
+        FragmentedType<std::shared_mutex, std::mutex> c(opts.fragments, opts.capacity);
+        runAll(c, "Fragmented", "shared_mutex/mutex", opts, traces);
+    }
+    {
+        auto& c = SharedType<std::shared_mutex>::getInstance();
+        c.initialize(opts.capacity);
+        runAll(c, "Shared", "shared_mutex", opts, traces);
+    }
+    {
+        auto& c = SharedType<std::mutex>::getInstance();
+        c.initialize(opts.capacity);
+        runAll(c, "Shared", "mutex", opts, traces);
+    }
+    {
+        auto& c = SharedFragmentedType<std::mutex>::getInstance();
+        c.initialize(opts.fragments, opts.capacity);
+        runAll(c, "SharedFragmented", "shared_mutex/shared_mutex/mutex", opts, traces);
+    }
+    {
+        auto& c = SharedFragmentedType<std::shared_mutex>::getInstance();
+        c.initialize(opts.fragments, opts.capacity);
+        runAll(c, "SharedFragmented", "shared_mutex/shared_mutex/shared_mutex", opts, traces);
+    }
+    return 0;
+}
@@ -4,7 +4,9 @@ set -u
 set -o pipefail
 
 output_file=$(mktemp)
-trap 'rm -f "$output_file"' EXIT
+trace_file=$(mktemp)
+simulator_bin=$(mktemp)
+trap 'rm -f "$output_file" "$trace_file" "$simulator_bin"' EXIT
 
 # shellcheck disable=SC2016
 if ! find ./tests -maxdepth 1 -type f -name '*_test.cpp' -print0 \
@@ -24,6 +26,23 @@ if ! find ./tests -maxdepth 1 -type f -name '*_test.cpp' -print0 \
     exit 84
 fi
 
+# Smoke-runs the trace simulator on a ten-access trace.
+printf '%s\n' 1 2 3 1 2 4 1 2 5 1 > "$trace_file"
+printf "\n[TOOL] ./tools/trace_simulator.cpp\n" | tee -a "$output_file"
+if ! g++ ./tools/trace_simulator.cpp -I . --std=c++20 -pthread -o "$simulator_bin"; then
+    exit 84
+fi
+if "$simulator_bin" "file=$trace_file" capacities=1,4 threads=2 | grep -q '^LRU,4,10,5,'; then
+    echo "[OK]   trace_simulator replays the trace" | tee -a "$output_file"
+else
+    echo "[FAIL] trace_simulator replays the trace" | tee -a "$output_file"
+fi
+if "$simulator_bin" "file=$trace_file" capacities=0 2>/dev/null; then
+    echo "[FAIL] trace_simulator rejects capacities=0" | tee -a "$output_file"
+else
+    echo "[OK]   trace_simulator rejects capacities=0" | tee -a "$output_file"
+fi
+
 if grep -q '^\[FAIL\]' "$output_file"; then
     exit 84
 fi
@@ -0,0 +1,163 @@
+// Access trace capture tests.
+#include <Cache/Base.hpp>
+#include <Cache/Fragmented.hpp>
+#include <Cache/Helpers/MutexLocks.hpp>
+#include <Cache/Strategy/LRU.hpp>
+#include <Cache/Trace/AccessTracer.hpp>
+#include <cstdint>
+#include <filesystem>
+#include <iostream>
+#include <limits>
+#include <memory>
+#include <shared_mutex>
+#include <stdexcept>
+#include <string>
+#include <thread>
+#include <vector>
+
+template <typename T>
+static void check_eq(const char* name, const T& got, const T& expected)
+{
+    if (got == expected)
+    {
+        std::cout << "[OK]   " << name << " | got=" << got << " expected=" << expected << "\n";
+    }
+    else
+    {
+        std::cout << "[FAIL] " << name << " | got=" << got << " expected=" << expected << "\n";
+    }
+}
+
+static void check_true(const char* name, bool cond)
+{
+    std::cout << (cond ? "[OK]   " : "[FAIL] ") << name << " | expected true\n";
+}
+
+static std::string tracePath(const char* name)
+{
+    return (std::filesystem::temp_directory_path() / name).string();
+}
+
+using Cache = cache::Base<int, std::string, cache::strategy::LRU<int, std::string>, std::hash<int>, std::equal_to<int>, std::shared_mutex>;
+
+static void test_base_records()
+{
+    std::cout << "\n=== Trace: Base records ===\n";
+    const auto path   = tracePath("cache_access_trace_base.bin");
+    auto       tracer = std::make_shared<cache::trace::AccessTracer>(path);
+
+    Cache       c(4);
+    std::string out;
+    c.put(1, "one");
+    c.setTracer(tracer);
+    (void) c.get(1, out);
+    (void) c.get(2, out);
+    c.put(2, "twenty");
+    c.put(2, "two");
+    c.remove(1);
+    c.setTracer(nullptr);
+    (void) c.get(2, out);
+    tracer->stop();
+
+    auto records = cache::trace::readTraceFile(path);
+    check_eq("records written", records.size(), std::size_t(5));
+    check_eq("tracer written()", tracer->written(), std::uint64_t(5));
+    if (records.size() == 5)
+    {
+        check_true("get hit", records[0].op == cache::trace::Op::GET && records[0].hit == 1);
+        check_eq("get hit value size", records[0].valueSize, std::uint32_t(3));
+        check_true("get miss", records[1].op == cache::trace::Op::GET && records[1].hit == 0);
+        check_eq("miss key hash", records[1].keyHash, std::uint64_t(std::hash<int>{}(2)));
+        check_true("put insert", records[2].op == cache::trace::Op::PUT && records[2].hit == 0);
+        check_true("put update", records[3].op == cache::trace::Op::PUT && records[3].hit == 1);
+        check_true("remove", records[4].op == cache::trace::Op::REMOVE && records[4].hit == 1);
+        check_true("timestamps ordered", records[0].timestampNs <= records[4].timestampNs);
+    }
+    std::filesystem::remove(path);
+}
+
+static void test_sampling_and_threads()
+{
+    std::cout << "\n=== Trace: sampling and threads ===\n";
+    const auto path   = tracePath("cache_access_trace_sampled.bin");
+    auto       tracer = std::make_shared<cache::trace::AccessTracer>(path, 0.25, 1 << 16);
+
+    cache::Fragmented<int, int> c(4, 1024);
+    c.setTracer(tracer);
+
+    std::vector<std::thread> threads;
+    for (int t = 0; t < 4; ++t)
+    {
+        threads.emplace_back(
+            [&c, t]
+            {
+                int out{};
+                for (int i = 0; i < 2000; ++i)
+                {
+                    (void) c.get(i, out);
+                    c.put(i, i + t);
+                }
+            });
+    }
+    for (auto& th : threads)
+    {
+        th.join();
+    }
+    tracer->stop();
+
+    auto              records        = cache::trace::readTraceFile(path);
+    bool              consistent     = true;
+    bool              fromAllThreads = true;
+    std::vector<bool> seen(4, false);
+    for (const auto& r : records)
+    {
+        consistent = consistent && tracer->sampled(r.keyHash);
+        if (r.thread < 4)
+        {
+            seen[r.thread] = true;
+        }
+    }
+    for (bool s : seen)
+    {
+        fromAllThreads = fromAllThreads && s;
+    }
+    const double fraction = static_cast<double>(records.size()) / (4.0 * 2 * 2000);
+    check_true("only sampled keys recorded", consistent);
+    check_true("sampled fraction near 25%", fraction > 0.15 && fraction < 0.35);
+    check_true("every thread has its ring", fromAllThreads);
+    check_eq("nothing dropped", tracer->dropped(), std::uint64_t(0));
+    check_eq("all records written", tracer->written(), std::uint64_t(records.size()));
+    std::filesystem::remove(path);
+}
+
+static void test_sample_rates()
+{
+    std::cout << "\n=== Trace: sample rate bounds ===\n";
+    const auto path = tracePath("cache_access_trace_rates.bin");
+    {
+        cache::trace::AccessTracer all(path, 1.0);
+        cache::trace::AccessTracer none(path, 0.0);
+        check_true("rate 1 samples every key", all.sampled(0) && all.sampled(~std::uint64_t(0)));
+        check_true("rate 0 samples no key", !none.sampled(0) && !none.sampled(~std::uint64_t(0)));
+    }
+    bool threw = false;
+    try
+    {
+        cache::trace::AccessTracer bad(path, std::numeric_limits<double>::quiet_NaN());
+    }
+    catch (const std::invalid_argument&)
+    {
+        threw = true;
+    }
+    check_true("NaN rate rejected", threw);
+    std::filesystem::remove(path);
+}
+
+int main()
+{
+    test_base_records();
+    test_sampling_and_threads();
+    test_sample_rates();
+    std::cout << "\nAll trace tests done.\n";
+    return 0;
+}
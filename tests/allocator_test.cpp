@@ -0,0 +1,192 @@
+// Allocator tests: caches allocate from a caller-provided resource, optionally through a per-cache arena.
+#include <Cache/Base.hpp>
+#include <Cache/Fragmented.hpp>
+#include <Cache/Memory/Arena.hpp>
+#include <Cache/Memory/CountingResource.hpp>
+#include <Cache/Strategy/2Q.hpp>
+#include <Cache/Strategy/FIFO.hpp>
+#include <Cache/Strategy/HalvedLFU.hpp>
+#include <Cache/Strategy/LFU.hpp>
+#include <Cache/Strategy/LRU.hpp>
+#include <Cache/Strategy/MRU.hpp>
+#include <Cache/Strategy/RedisLFU.hpp>
+#include <Cache/Strategy/SLRU.hpp>
+#include <iostream>
+#include <memory_resource>
+#include <mutex>
+#include <shared_mutex>
+#include <string>
+#include <vector>
+
+// Shared check helpers
+template <typename T>
+static void check_eq(const char* name, const T& got, const T& expected)
+{
+    if (got == expected)
+    {
+        std::cout << "[OK]   " << name << " | got=" << got << " expected=" << expected << "\n";
+    }
+    else
+    {
+        std::cout << "[FAIL] " << name << " | got=" << got << " expected=" << expected << "\n";
+    }
+}
+
+static void check_true(const char* name, bool cond)
+{
+    std::cout << (cond ? "[OK]   " : "[FAIL] ") << name << " | expected true\n";
+}
+
+static void check_false(const char* name, bool cond)
+{
+    std::cout << (!cond ? "[OK]   " : "[FAIL] ") << name << " | expected false\n";
+}
+
+static void test_arena()
+{
+    std::cout << "\n=== arena ===\n";
+    cache::memory::CountingResource upstream;
+    cache::memory::Arena            arena(&upstream);
+    check_true("arena forwards to its upstream", arena.upstream() == &upstream);
+    {
+        std::pmr::vector<int> v(&arena);
+        v.reserve(1000);
+        check_eq("one live block", arena.liveBlocks(), std::size_t(1));
+        check_false("release refused while a block is live", arena.release());
+        cache::memory::release(v);
+        check_eq("memory::release frees the capacity", v.capacity(), std::size_t(0));
+        check_eq("no live block left", arena.liveBlocks(), std::size_t(0));
+    }
+    check_true("arena kept its chunks", upstream.bytes() > 0);
+    check_true("release accepted once empty", arena.release());
+    check_eq("chunks handed back upstream", upstream.bytes(), std::size_t(0));
+}
+
+static void test_base_upstream()
+{
+    std::cout << "\n=== Base on a caller resource ===\n";
+    cache::memory::CountingResource upstream;
+    {
+        cache::Base<std::string, int> c(64, &upstream);
+        const std::size_t             empty = upstream.blocks();
+        check_true("buckets come from the resource", empty > 0);
+        for (int i = 0; i < 64; ++i)
+        {
+            c.put(std::to_string(i), i);
+        }
+        check_true("map and strategy nodes come from the resource", upstream.blocks() >= empty + 64 * 3);
+        int out = 0;
+        check_true("cache still works", c.get("42", out));
+        check_eq("value read back", out, 42);
+    }
+    check_eq("everything returned on destruction", upstream.bytes(), std::size_t(0));
+}
+
+template <typename Strategy>
+static void test_arena_clear(const char* name)
+{
+    std::cout << "\n=== " << name << " arena clear ===\n";
+    cache::memory::CountingResource upstream;
+    {
+        cache::Base<int, std::string, Strategy> c(256, &upstream, cache::memory::Allocation::ARENA);
+        const std::size_t                       sized = upstream.bytes();
+        for (int i = 0; i < 2000; ++i)
+        {
+            c.put(i, std::to_string(i));
+            std::string out;
+            (void) c.get(i / 2, out);
+        }
+        const std::size_t full = upstream.bytes();
+        check_true("arena grows with entries", full > sized);
+
+        c.clear();
+        check_eq("cleared", c.size(), std::size_t(0));
+        check_eq("clear hands the arena back to its freshly sized state", upstream.bytes(), sized);
+
+        for (int i = 0; i < 300; ++i)
+        {
+            c.put(i, std::to_string(i));
+        }
+        std::string out;
+        check_true("refilled after clear", c.get(299, out));
+        check_eq("refilled value", out, std::string("299"));
+        check_eq("capacity kept", c.size(), std::size_t(256));
+    }
+    check_eq("everything returned on destruction", upstream.bytes(), std::size_t(0));
+}
+
+static void test_strategy_upstream()
+{
+    std::cout << "\n=== strategy on a caller resource ===\n";
+    cache::memory::CountingResource upstream;
+    {
+        cache::strategy::SLRU<int, int> s(&upstream);
+        s.reserve(16);
+        for (int i = 0; i < 16; ++i)
+        {
+            (void) s.onInsert(i);
+            (void) s.onAccess(i);
+        }
+        check_true("strategy allocates from the resource", upstream.blocks() > 16);
+        s.release();
+        check_eq("release() frees everything", upstream.bytes(), std::size_t(0));
+        s.reserve(16);
+        check_true("reusable after release()", s.onInsert(1));
+    }
+    check_eq("everything returned on destruction", upstream.bytes(), std::size_t(0));
+}
+
+static void test_fragmented_arena()
+{
+    std::cout << "\n=== Fragmented arena ===\n";
+    using Cache = cache::Fragmented<int, int, cache::strategy::LRU<int, int>, std::hash<int>, std::equal_to<int>, std::shared_mutex, std::mutex>;
+    cache::memory::CountingResource upstream;
+    {
+        Cache c(4, 256, &upstream, cache::memory::Allocation::ARENA);
+        for (int i = 0; i < 1000; ++i)
+        {
+            c.put(i, i);
+        }
+        const std::size_t full = upstream.bytes();
+        check_true("fragments allocate from the resource", full > 0);
+        c.clear();
+        check_true("fragment arenas released on clear", upstream.bytes() < full);
+        c.put(7, 7);
+        int out = 0;
+        check_true("usable after clear", c.get(7, out));
+    }
+    check_eq("everything returned on destruction", upstream.bytes(), std::size_t(0));
+}
+
+static void test_weighted_empty_resize()
+{
+    std::cout << "\n=== weighted resize while empty ===\n";
+    cache::Base<int, std::string, cache::strategy::LRU<int, std::string>, std::hash<int>, std::equal_to<int>, std::shared_mutex, cache::stats::NoStats,
+                cache::weigher::ByteSize>
+        c(4096, std::pmr::get_default_resource(), cache::memory::Allocation::ARENA);
+    c.setCapacity(2048);
+    c.clear();
+    c.put(1, "one");
+    std::string out;
+    check_true("weighted arena cache usable", c.get(1, out));
+}
+
+int main()
+{
+    test_arena();
+    test_base_upstream();
+    test_arena_clear<cache::strategy::LRU<int, std::string>>("LRU");
+    test_arena_clear<cache::strategy::MRU<int, std::string>>("MRU");
+    test_arena_clear<cache::strategy::FIFO<int, std::string>>("FIFO");
+    test_arena_clear<cache::strategy::LFU<int, std::string>>("LFU");
+    test_arena_clear<cache::strategy::HalvedLFU<int, std::string>>("HalvedLFU");
+    test_arena_clear<cache::strategy::RedisLFU<int, std::string>>("RedisLFU");
+    test_arena_clear<cache::strategy::SLRU<int, std::string>>("SLRU");
+    test_arena_clear<cache::strategy::TwoQueues<int, std::string>>("2Q");
+    test_strategy_upstream();
+    test_fragmented_arena();
+    test_weighted_empty_resize();
+
+    std::cout << "\nAll allocator tests done.\n";
+    return 0;
+}
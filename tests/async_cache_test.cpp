@@ -0,0 +1,267 @@
+// Coroutine loading tests: awaiters of a key share one load and are resumed on the executor.
+#include <Cache/Async/AsyncCache.hpp>
+#include <Cache/Async/Executor.hpp>
+#include <Cache/Base.hpp>
+#include <Cache/Stats/CacheStats.hpp>
+#include <Cache/Strategy/LRU.hpp>
+#include <atomic>
+#include <chrono>
+#include <coroutine>
+#include <exception>
+#include <iostream>
+#include <latch>
+#include <memory>
+#include <shared_mutex>
+#include <stdexcept>
+#include <string>
+#include <thread>
+#include <vector>
+
+// Shared check helpers
+template <typename T>
+static void check_eq(const char* name, const T& got, const T& expected)
+{
+    if (got == expected)
+    {
+        std::cout << "[OK]   " << name << " | got=" << got << " expected=" << expected << "\n";
+    }
+    else
+    {
+        std::cout << "[FAIL] " << name << " | got=" << got << " expected=" << expected << "\n";
+    }
+}
+
+static void check_true(const char* name, bool cond)
+{
+    std::cout << (cond ? "[OK]   " : "[FAIL] ") << name << " | expected true\n";
+}
+
+// Fire-and-forget coroutine, standing in for a request handler.
+struct Detached
+{
+    struct promise_type
+    {
+        Detached get_return_object() noexcept
+        {
+            return {};
+        }
+
+        std::suspend_never initial_suspend() noexcept
+        {
+            return {};
+        }
+
+        std::suspend_never final_suspend() noexcept
+        {
+            return {};
+        }
+
+        void return_void() noexcept
+        { }
+
+        void unhandled_exception() noexcept
+        {
+            std::terminate();
+        }
+    };
+};
+
+using Cache = cache::Base<int, std::string>;
+using Async = cache::async::AsyncCache<Cache, cache::stats::StripedStats<>>;
+
+struct Result
+{
+    std::string     value;
+    std::string     error;
+    std::thread::id resumedOn;
+};
+
+template <typename A>
+static Detached handle(A& async, int key, typename A::Loader loader, Result& out, std::latch& done)
+{
+    try
+    {
+        out.value = co_await async.getOrLoadAsync(key, std::move(loader));
+    }
+    catch (const std::exception& e)
+    {
+        out.error = e.what();
+    }
+    out.resumedOn = std::this_thread::get_id();
+    done.count_down();
+}
+
+static void test_shared_load()
+{
+    std::cout << "\n=== concurrent awaiters share one load ===\n";
+    auto             pool = std::make_shared<cache::async::ThreadPool>(4);
+    Cache            c(64);
+    std::atomic<int> calls{0};
+    {
+        Async               async(c, pool);
+        auto                slow = [&calls](const int& key) {
+            ++calls;
+            std::this_thread::sleep_for(std::chrono::milliseconds(50));
+            return "v" + std::to_string(key);
+        };
+        std::vector<Result> results(16);
+        std::latch          done(16);
+        for (auto& result : results)
+        {
+            handle(async, 7, slow, result, done);
+        }
+        check_eq("every awaiter joined one load", async.inFlight(), std::size_t(1));
+        done.wait();
+
+        int correct = 0;
+        int onPool  = 0;
+        for (const auto& result : results)
+        {
+            correct += result.value == "v7" ? 1 : 0;
+            onPool += result.resumedOn != std::this_thread::get_id() ? 1 : 0;
+        }
+        check_eq("loader called once", calls.load(), 1);
+        check_eq("every awaiter got the value", correct, 16);
+        check_eq("resumed on the executor", onPool, 16);
+        check_true("value cached", c.contains(7));
+        check_eq("load recorded", async.stats().loadSuccesses, std::uint64_t(1));
+
+        Result     hit;
+        std::latch hitDone(1);
+        handle(async, 7, slow, hit, hitDone);
+        hitDone.wait();
+        check_eq("hit served from the cache", hit.value, std::string("v7"));
+        check_true("hit completes on the awaiting thread", hit.resumedOn == std::this_thread::get_id());
+        check_eq("hit does not load", calls.load(), 1);
+    }
+}
+
+static void test_failure()
+{
+    std::cout << "\n=== failing load ===\n";
+    auto             pool = std::make_shared<cache::async::ThreadPool>(2);
+    Cache            c(8);
+    Async            async(c, pool);
+    std::atomic<int> calls{0};
+    auto             failing = [&calls](const int&) -> std::string {
+        ++calls;
+        std::this_thread::sleep_for(std::chrono::milliseconds(20));
+        throw std::runtime_error("backend down");
+    };
+    std::vector<Result> results(4);
+    std::latch          done(4);
+    for (auto& result : results)
+    {
+        handle(async, 1, failing, result, done);
+    }
+    done.wait();
+    int failed = 0;
+    for (const auto& result : results)
+    {
+        failed += result.error == "backend down" ? 1 : 0;
+    }
+    check_eq("every awaiter sees the exception", failed, 4);
+    check_true("nothing cached", !c.contains(1));
+    check_eq("failure recorded", async.stats().loadFailures, std::uint64_t(1));
+
+    Result     retry;
+    std::latch retryDone(1);
+    handle(async, 1, [](const int&) { return std::string("ok"); }, retry, retryDone);
+    retryDone.wait();
+    check_eq("next await loads again", retry.value, std::string("ok"));
+}
+
+static void test_inline_executor()
+{
+    std::cout << "\n=== inline executor ===\n";
+    Cache      c(8);
+    Async      async(c, std::make_shared<cache::async::InlineExecutor>());
+    Result     result;
+    std::latch done(1);
+    handle(async, 3, [](const int& key) { return std::to_string(key * 2); }, result, done);
+    check_eq("completed synchronously", result.value, std::string("6"));
+    check_true("on the calling thread", result.resumedOn == std::this_thread::get_id());
+    check_eq("no load left in flight", async.inFlight(), std::size_t(0));
+
+    bool threw = false;
+    try
+    {
+        Async bad(c, nullptr);
+    }
+    catch (const std::invalid_argument&)
+    {
+        threw = true;
+    }
+    check_true("executor required", threw);
+}
+
+static void test_miss_counted_once()
+{
+    std::cout << "\n=== cold load counts one miss ===\n";
+    using CountedCache = cache::Base<int, std::string, cache::strategy::LRU<int, std::string>, std::hash<int>, std::equal_to<int>, std::shared_mutex,
+                                     cache::stats::StripedStats<>>;
+    CountedCache                           c(8);
+    cache::async::AsyncCache<CountedCache> async(c, std::make_shared<cache::async::InlineExecutor>());
+    Result                                 result;
+    std::latch                             done(1);
+    handle(async, 5, [](const int& key) { return std::to_string(key); }, result, done);
+    check_eq("value loaded", result.value, std::string("5"));
+    check_eq("one miss", async.stats().misses, std::uint64_t(1));
+    check_eq("no hit", async.stats().hits, std::uint64_t(0));
+}
+
+static void test_many_keys()
+{
+    std::cout << "\n=== many keys ===\n";
+    auto             pool = std::make_shared<cache::async::ThreadPool>(4);
+    Cache            c(1024);
+    std::atomic<int> calls{0};
+    Async            async(c, pool);
+    auto             loader = [&calls](const int& key) {
+        ++calls;
+        return std::to_string(key);
+    };
+    std::vector<Result> results(400);
+    std::latch          done(400);
+    for (std::size_t i = 0; i < results.size(); ++i)
+    {
+        handle(async, static_cast<int>(i % 100), loader, results[i], done);
+    }
+    done.wait();
+    int correct = 0;
+    for (std::size_t i = 0; i < results.size(); ++i)
+    {
+        correct += results[i].value == std::to_string(i % 100) ? 1 : 0;
+    }
+    check_eq("every awaiter got its key's value", correct, 400);
+    check_true("at most one load per key", calls.load() <= 100);
+}
+
+static void test_thread_pool()
+{
+    std::cout << "\n=== thread pool ===\n";
+    std::atomic<int> ran{0};
+    {
+        cache::async::ThreadPool pool(3);
+        check_eq("worker count", pool.size(), std::size_t(3));
+        for (int i = 0; i < 100; ++i)
+        {
+            pool.execute([&ran] { ++ran; });
+        }
+        pool.execute([] { throw std::runtime_error("ignored"); });
+    }
+    check_eq("queued tasks run before destruction", ran.load(), 100);
+}
+
+int main()
+{
+    test_shared_load();
+    test_failure();
+    test_inline_executor();
+    test_miss_counted_once();
+    test_many_keys();
+    test_thread_pool();
+
+    std::cout << "\nAll async cache tests done.\n";
+    return 0;
+}
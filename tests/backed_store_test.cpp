@@ -0,0 +1,260 @@
+// Backing store tests: read-through, write-through and batched write-behind against an in-process store.
+#include <Cache/Base.hpp>
+#include <Cache/Fragmented.hpp>
+#include <Cache/Stats/CacheStats.hpp>
+#include <Cache/Store/Backed.hpp>
+#include <Cache/Strategy/LRU.hpp>
+#include <atomic>
+#include <iostream>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <shared_mutex>
+#include <span>
+#include <stdexcept>
+#include <string>
+#include <thread>
+#include <vector>
+
+// Shared check helpers
+template <typename T>
+static void check_eq(const char* name, const T& got, const T& expected)
+{
+    if (got == expected)
+    {
+        std::cout << "[OK]   " << name << " | got=" << got << " expected=" << expected << "\n";
+    }
+    else
+    {
+        std::cout << "[FAIL] " << name << " | got=" << got << " expected=" << expected << "\n";
+    }
+}
+
+static void check_true(const char* name, bool cond)
+{
+    std::cout << (cond ? "[OK]   " : "[FAIL] ") << name << " | expected true\n";
+}
+
+static void check_false(const char* name, bool cond)
+{
+    std::cout << (!cond ? "[OK]   " : "[FAIL] ") << name << " | expected false\n";
+}
+
+// Stand-in for a remote store, counting the calls it receives.
+class MemoryStore final : public cache::store::ILoader<int, std::string>, public cache::store::IWriter<int, std::string>
+{
+  public:
+    std::optional<std::string> load(const int& key) override
+    {
+        std::lock_guard<std::mutex> lock(_mtx);
+        ++loads;
+        if (failLoads)
+        {
+            throw std::runtime_error("store unavailable");
+        }
+        auto it = _data.find(key);
+        return it == _data.end() ? std::nullopt : std::optional<std::string>(it->second);
+    }
+
+    void write(const int& key, const std::string& value) override
+    {
+        std::lock_guard<std::mutex> lock(_mtx);
+        ++writes;
+        _data[key] = value;
+    }
+
+    void erase(const int& key) override
+    {
+        std::lock_guard<std::mutex> lock(_mtx);
+        ++erases;
+        _data.erase(key);
+    }
+
+    void writeAll(std::span<const cache::store::Write<int, std::string>> batch) override
+    {
+        if (failWrites)
+        {
+            throw std::runtime_error("store unavailable");
+        }
+        ++batches;
+        batchedChanges += static_cast<int>(batch.size());
+        IWriter::writeAll(batch);
+    }
+
+    void seed(int key, const std::string& value)
+    {
+        std::lock_guard<std::mutex> lock(_mtx);
+        _data[key] = value;
+    }
+
+    [[nodiscard]] std::optional<std::string> peek(int key)
+    {
+        std::lock_guard<std::mutex> lock(_mtx);
+        auto                        it = _data.find(key);
+        return it == _data.end() ? std::nullopt : std::optional<std::string>(it->second);
+    }
+
+    std::atomic<int>  loads{0};
+    std::atomic<int>  writes{0};
+    std::atomic<int>  erases{0};
+    std::atomic<int>  batches{0};
+    std::atomic<int>  batchedChanges{0};
+    std::atomic<bool> failLoads{false};
+    std::atomic<bool> failWrites{false};
+
+  private:
+    std::mutex                 _mtx;
+    std::map<int, std::string> _data;
+};
+
+using Cache = cache::Base<int, std::string>;
+using Store = cache::store::Backed<Cache, cache::stats::StripedStats<>>;
+
+static void test_read_through()
+{
+    std::cout << "\n=== read-through ===\n";
+    auto store = std::make_shared<MemoryStore>();
+    store->seed(1, "one");
+    Cache       c(8);
+    Store       backed(c, store, store);
+    std::string out;
+    check_true("miss loaded from the store", backed.get(1, out));
+    check_eq("loaded value", out, std::string("one"));
+    check_true("second get served by the cache", backed.get(1, out));
+    check_eq("store loaded once", store->loads.load(), 1);
+    check_false("absent key stays a miss", backed.get(2, out));
+
+    store->failLoads = true;
+    bool threw       = false;
+    try
+    {
+        (void) backed.get(3, out);
+    }
+    catch (const std::runtime_error&)
+    {
+        threw = true;
+    }
+    check_true("loader failure reaches the caller", threw);
+
+    const auto snap = backed.stats();
+    check_eq("successful loads", snap.loadSuccesses, std::uint64_t(1));
+    check_eq("failed or empty loads", snap.loadFailures, std::uint64_t(2));
+}
+
+static void test_write_through()
+{
+    std::cout << "\n=== write-through ===\n";
+    auto  store = std::make_shared<MemoryStore>();
+    Cache c(8);
+    Store backed(c, store, store);
+    backed.put(1, "one");
+    check_true("put reached the store", store->peek(1) == std::optional<std::string>("one"));
+    check_true("and the cache", c.contains(1));
+    backed.remove(1);
+    check_false("remove reached the store", store->peek(1).has_value());
+    check_false("and the cache", c.contains(1));
+
+    store->failWrites = true;
+    Store readOnly(c, store, nullptr);
+    readOnly.put(2, "two");
+    check_true("without a writer the cache still takes puts", c.contains(2));
+    check_false("and the store sees nothing", store->peek(2).has_value());
+}
+
+static void test_write_behind()
+{
+    std::cout << "\n=== write-behind ===\n";
+    auto  store = std::make_shared<MemoryStore>();
+    Cache c(4);
+    {
+        Store backed(c, store, store, cache::store::WriteMode::BEHIND, {64, std::chrono::milliseconds(50), 1024});
+        for (int round = 0; round < 20; ++round)
+        {
+            for (int key = 0; key < 50; ++key)
+            {
+                backed.put(key, std::to_string(round));
+            }
+        }
+        std::string out;
+        check_true("value evicted from the cache served from the queue or store", backed.get(0, out));
+        check_eq("latest value", out, std::string("19"));
+        backed.remove(49);
+        check_false("queued removal hides the entry", backed.get(49, out));
+
+        check_true("flush succeeds", backed.flush());
+        check_eq("nothing pending after flush", backed.pending(), std::size_t(0));
+        check_true("store has the latest value", store->peek(10) == std::optional<std::string>("19"));
+        check_false("store saw the removal", store->peek(49).has_value());
+        check_true("writes were coalesced per key", store->writes.load() + store->erases.load() < 1000);
+        check_true("and batched", store->batches.load() < store->batchedChanges.load());
+        check_eq("batches counted", backed.batches(), static_cast<std::uint64_t>(store->batches.load()));
+        check_eq("store never read", store->loads.load(), 0);
+
+        backed.put(100, "late");
+    }
+    check_true("destructor writes what is still queued", store->peek(100) == std::optional<std::string>("late"));
+}
+
+static void test_write_behind_failures()
+{
+    std::cout << "\n=== write-behind failures ===\n";
+    auto  store = std::make_shared<MemoryStore>();
+    Cache c(16);
+    Store backed(c, store, store, cache::store::WriteMode::BEHIND, {8, std::chrono::milliseconds(10), 64});
+    store->failWrites = true;
+    for (int key = 0; key < 10; ++key)
+    {
+        backed.put(key, "v");
+    }
+    check_false("flush reports the failure", backed.flush());
+    check_eq("changes kept for the retry", backed.pending(), std::size_t(10));
+    check_true("failures counted", backed.writeFailures() > 0);
+
+    backed.put(3, "newer");
+    store->failWrites = false;
+    check_true("retry succeeds", backed.flush());
+    check_eq("queue drained", backed.pending(), std::size_t(0));
+    check_true("newer change kept over the retried one", store->peek(3) == std::optional<std::string>("newer"));
+    check_true("older changes written", store->peek(9) == std::optional<std::string>("v"));
+}
+
+static void test_fragmented_concurrent()
+{
+    std::cout << "\n=== fragmented, concurrent writers ===\n";
+    using FragmentedCache = cache::Fragmented<int, std::string, cache::strategy::LRU<int, std::string>, std::hash<int>, std::equal_to<int>, std::shared_mutex,
+                                              std::mutex>;
+    auto            store = std::make_shared<MemoryStore>();
+    FragmentedCache c(4, 64);
+    {
+        cache::store::Backed<FragmentedCache> backed(c, store, store, cache::store::WriteMode::BEHIND, {32, std::chrono::milliseconds(5), 128});
+        std::vector<std::thread>              threads;
+        for (int t = 0; t < 4; ++t)
+        {
+            threads.emplace_back([&backed, t] {
+                for (int i = 0; i < 500; ++i)
+                {
+                    backed.put(t * 1000 + i % 100, std::to_string(i));
+                }
+            });
+        }
+        for (auto& thread : threads)
+        {
+            thread.join();
+        }
+        check_true("flush succeeds", backed.flush());
+    }
+    check_true("every thread's last value stored", store->peek(3099) == std::optional<std::string>("499"));
+    check_true("bounded queue forced batching", store->batches.load() > 1);
+}
+
+int main()
+{
+    test_read_through();
+    test_write_through();
+    test_write_behind();
+    test_write_behind_failures();
+    test_fragmented_concurrent();
+
+    std::cout << "\nAll backed store tests done.\n";
+    return 0;
+}
@@ -0,0 +1,272 @@
+// Cache statistics tests.
+#include <Cache/Base.hpp>
+#include <Cache/Fragmented.hpp>
+#include <Cache/Helpers/MutexLocks.hpp>
+#include <Cache/MethodManager.hpp>
+#include <Cache/Shared.hpp>
+#include <Cache/Stats/CacheStats.hpp>
+#include <Cache/Strategy/LRU.hpp>
+#include <cstdint>
+#include <iostream>
+#include <shared_mutex>
+#include <thread>
+#include <type_traits>
+#include <vector>
+
+template <typename T>
+static void check_eq(const char* name, const T& got, const T& expected)
+{
+    if (got == expected)
+    {
+        std::cout << "[OK]   " << name << " | got=" << got << " expected=" << expected << "\n";
+    }
+    else
+    {
+        std::cout << "[FAIL] " << name << " | got=" << got << " expected=" << expected << "\n";
+    }
+}
+
+static void check_true(const char* name, bool cond)
+{
+    std::cout << (cond ? "[OK]   " : "[FAIL] ") << name << " | expected true\n";
+}
+
+using Striped = cache::stats::StripedStats<>;
+
+template <typename Stats, typename Mutex = cache::mutex_locks::NoLock>
+using IntCache = cache::Base<int, int, cache::strategy::LRU<int, int>, std::hash<int>, std::equal_to<int>, Mutex, Stats>;
+
+static void test_disabled_stats()
+{
+    std::cout << "\n=== Stats: disabled by default ===\n";
+    check_true("NoStats is an empty type", std::is_empty_v<cache::stats::NoStats>);
+    check_true("NoStats adds no storage to Base", sizeof(IntCache<cache::stats::NoStats>) < sizeof(IntCache<Striped>));
+
+    IntCache<cache::stats::NoStats> c(2);
+    c.put(1, 1);
+    int out{};
+    (void) c.get(1, out);
+    (void) c.get(2, out);
+    check_eq("hits stay at zero", c.stats().hits, std::uint64_t(0));
+    check_eq("misses stay at zero", c.stats().misses, std::uint64_t(0));
+}
+
+static void test_base_counters()
+{
+    std::cout << "\n=== Stats: Base counters ===\n";
+    IntCache<Striped> c(2);
+    int               out{};
+
+    c.put(1, 10);
+    c.put(2, 20);
+    (void) c.get(1, out);
+    (void) c.get(1, out);
+    (void) c.get(3, out);
+    c.put(3, 30); // evicts 2
+    c.put(3, 31); // update
+
+    c.invalidateIf([](const int& k, const int&) { return k == 1; });
+    (void) c.get(1, out);
+
+    auto s = c.stats();
+    check_eq("hits", s.hits, std::uint64_t(2));
+    check_eq("misses", s.misses, std::uint64_t(2));
+    check_eq("puts", s.puts, std::uint64_t(4));
+    check_eq("evictions", s.evictions, std::uint64_t(1));
+    check_eq("invalidations", s.invalidations, std::uint64_t(1));
+    check_eq("hit ratio", s.hitRatio(), 0.5);
+}
+
+static void test_concurrent_counters()
+{
+    std::cout << "\n=== Stats: concurrent recording ===\n";
+    IntCache<Striped, std::shared_mutex> c(64);
+    for (int i = 0; i < 32; ++i)
+    {
+        c.put(i, i);
+    }
+
+    constexpr int            threads = 8;
+    constexpr int            ops     = 6400;
+    std::vector<std::thread> pool;
+    for (int t = 0; t < threads; ++t)
+    {
+        pool.emplace_back([&c, t] {
+            int out{};
+            for (int i = 0; i < ops; ++i)
+            {
+                (void) c.get((i + t) % 64, out);
+            }
+        });
+    }
+    for (auto& th : pool)
+    {
+        th.join();
+    }
+
+    auto s = c.stats();
+    check_eq("every lookup is counted once", s.hits + s.misses, std::uint64_t(threads * ops));
+    check_eq("hits match the resident half", s.hits, std::uint64_t(threads * ops / 2));
+}
+
+static void test_aggregation()
+{
+    std::cout << "\n=== Stats: Fragmented and Shared aggregation ===\n";
+    cache::Fragmented<int, int, cache::strategy::LRU<int, int>, std::hash<int>, std::equal_to<int>, std::shared_mutex, std::shared_mutex, Striped> frag(4, 64);
+
+    int out{};
+    for (int i = 0; i < 16; ++i)
+    {
+        frag.put(i, i);
+    }
+    for (int i = 0; i < 32; ++i)
+    {
+        (void) frag.get(i, out);
+    }
+    check_eq("fragmented puts", frag.stats().puts, std::uint64_t(16));
+    check_eq("fragmented hits", frag.stats().hits, std::uint64_t(16));
+    check_eq("fragmented misses", frag.stats().misses, std::uint64_t(16));
+
+    cache::Fragmented<int, int, cache::strategy::LRU<int, int>, std::hash<int>, std::equal_to<int>, std::shared_mutex, std::shared_mutex, Striped> cold(4, 64);
+    for (int i = 0; i < 8; ++i)
+    {
+        (void) cold.get(i, out);
+    }
+    check_eq("misses before any fragment exists", cold.stats().misses, std::uint64_t(8));
+    std::uint64_t coldMisses = 0;
+    for (const auto& f : cold.fragmentStats())
+    {
+        coldMisses += f.misses;
+    }
+    check_eq("per-fragment misses before creation", coldMisses, std::uint64_t(8));
+    cold.put(0, 0);
+    (void) cold.get(4, out);
+    check_eq("misses kept once the fragment exists", cold.stats().misses, std::uint64_t(9));
+
+    using SharedCache = cache::Shared<int, int, cache::strategy::LRU<int, int>, std::hash<int>, std::equal_to<int>, std::shared_mutex, Striped>;
+    auto& shared      = SharedCache::getInstance();
+    shared.initialize(8);
+    shared.put(1, 1);
+    (void) shared.get(1, out);
+    (void) shared.get(2, out);
+    check_eq("shared hits", shared.stats().hits, std::uint64_t(1));
+    check_eq("shared misses", shared.stats().misses, std::uint64_t(1));
+}
+
+static void test_method_manager()
+{
+    std::cout << "\n=== Stats: MethodManager registry ===\n";
+    using Cache = IntCache<Striped, std::shared_mutex>;
+    auto& mgr   = cache::MethodManager<>::getInstance();
+    auto& c     = mgr.getMethodCache<int, int, cache::strategy::LRU<int, int>, std::hash<int>, std::equal_to<int>, std::shared_mutex, Cache>("Stats", "square");
+    int   out{};
+    if (!c.get(3, out))
+    {
+        c.put(3, 9);
+    }
+    (void) c.get(3, out);
+
+    auto all = mgr.stats();
+    check_eq("one registered method", all.size(), std::size_t(1));
+    if (!all.empty())
+    {
+        check_eq("method name", all[0].methodName, std::string("square"));
+        check_eq("method hits", all[0].snapshot.hits, std::uint64_t(1));
+        check_eq("method misses", all[0].snapshot.misses, std::uint64_t(1));
+    }
+}
+
+static void test_histogram_buckets()
+{
+    std::cout << "\n=== Stats: latency histogram buckets ===\n";
+    using H = cache::stats::Histogram;
+    check_eq("small values are exact", H::upperBound(H::bucketFor(5)), std::uint64_t(5));
+
+    bool bounded = true;
+    for (std::uint64_t v : {8ULL, 9ULL, 100ULL, 1000ULL, 123456ULL, 987654321ULL})
+    {
+        const std::uint64_t ub = H::upperBound(H::bucketFor(v));
+        bounded                = bounded && ub >= v && ub - v <= v / 8;
+    }
+    check_true("bucket upper bound within 12.5%", bounded);
+    check_eq("huge values saturate", H::bucketFor(~0ULL), H::bucketCount - 1);
+    check_eq("2^41 saturates to the last bucket", H::bucketFor(std::uint64_t(1) << 41), H::bucketCount - 1);
+    check_eq("2^40 saturates to the last bucket", H::bucketFor(std::uint64_t(1) << 40), H::bucketCount - 1);
+    check_eq("just below 2^40 is the last bucket", H::bucketFor((std::uint64_t(1) << 40) - 1), H::bucketCount - 1);
+
+    H h;
+    for (std::uint64_t v = 1; v <= 100; ++v)
+    {
+        ++h.counts[H::bucketFor(v * 1000)];
+    }
+    check_eq("count()", h.count(), std::uint64_t(100));
+    const auto p50 = h.percentile(0.5).count();
+    const auto p99 = h.percentile(0.99).count();
+    check_true("p50 near 50us", p50 >= 50000 && p50 <= 50000 + 50000 / 8);
+    check_true("p99 near 99us", p99 >= 99000 && p99 <= 99000 + 99000 / 8);
+    check_eq("empty percentile", H{}.percentile(0.9).count(), std::int64_t(0));
+}
+
+static void test_timed_stats()
+{
+    std::cout << "\n=== Stats: timed get/put and lock wait ===\n";
+    using Timed = cache::stats::TimedStats<>;
+    check_true("StripedStats is not timed", !Striped::timed);
+
+    IntCache<Timed, std::shared_mutex> c(16);
+    int                                out{};
+    for (int i = 0; i < 10; ++i)
+    {
+        c.put(i, i);
+    }
+    for (int i = 0; i < 20; ++i)
+    {
+        (void) c.get(i, out);
+    }
+    auto snap = c.stats();
+    check_eq("put samples", snap.putLatency.count(), std::uint64_t(10));
+    check_eq("get samples", snap.getLatency.count(), std::uint64_t(20));
+    check_eq("lock wait samples", snap.lockWait.count(), std::uint64_t(30));
+    check_eq("counters still recorded", snap.hits, std::uint64_t(10));
+    check_true("p50 <= p99", snap.getLatency.percentile(0.5) <= snap.getLatency.percentile(0.99));
+
+    IntCache<Timed> unlocked(4);
+    unlocked.put(1, 1);
+    check_eq("NoLock records no lock wait", unlocked.stats().lockWait.count(), std::uint64_t(0));
+
+    cache::Fragmented<int, int, cache::strategy::LRU<int, int>, std::hash<int>, std::equal_to<int>, std::shared_mutex, std::shared_mutex, Timed> frag(4, 64);
+    for (int i = 0; i < 8; ++i)
+    {
+        frag.put(i, i);
+    }
+    auto          perFragment = frag.fragmentStats();
+    std::uint64_t sum         = 0;
+    for (const auto& f : perFragment)
+    {
+        sum += f.putLatency.count();
+    }
+    check_eq("one snapshot per fragment", perFragment.size(), std::size_t(4));
+    check_eq("fragment samples add up", sum, std::uint64_t(8));
+    check_eq("fragmented aggregate", frag.stats().putLatency.count(), std::uint64_t(8));
+
+    using SharedCache = cache::Shared<int, int, cache::strategy::LRU<int, int>, std::hash<int>, std::equal_to<int>, std::shared_mutex, Timed>;
+    auto& shared      = SharedCache::getInstance();
+    shared.initialize(8);
+    shared.put(1, 1);
+    (void) shared.get(1, out);
+    check_eq("shared wrapper lock wait samples", shared.stats().lockWait.count(), std::uint64_t(2));
+    check_eq("shared get samples", shared.stats().getLatency.count(), std::uint64_t(1));
+}
+
+int main()
+{
+    test_disabled_stats();
+    test_base_counters();
+    test_concurrent_counters();
+    test_aggregation();
+    test_method_manager();
+    test_histogram_buckets();
+    test_timed_stats();
+    std::cout << "\nAll stats tests done.\n";
+    return 0;
+}
@@ -0,0 +1,258 @@
+// Runtime capacity resizing tests.
+#include <Cache/Base.hpp>
+#include <Cache/Fragmented.hpp>
+#include <Cache/Shared.hpp>
+#include <Cache/SharedFragmented.hpp>
+#include <Cache/Strategy/2Q.hpp>
+#include <Cache/Strategy/FIFO.hpp>
+#include <Cache/Strategy/LFU.hpp>
+#include <Cache/Strategy/LRU.hpp>
+#include <Cache/Strategy/RedisLFU.hpp>
+#include <Cache/Strategy/SLRU.hpp>
+#include <iostream>
+#include <mutex>
+#include <shared_mutex>
+#include <stdexcept>
+#include <unordered_map>
+
+// Shared check helpers
+template <typename T>
+static void check_eq(const char* name, const T& got, const T& expected)
+{
+    if (got == expected)
+    {
+        std::cout << "[OK]   " << name << " | got=" << got << " expected=" << expected << "\n";
+    }
+    else
+    {
+        std::cout << "[FAIL] " << name << " | got=" << got << " expected=" << expected << "\n";
+    }
+}
+
+static void check_true(const char* name, bool cond)
+{
+    std::cout << (cond ? "[OK]   " : "[FAIL] ") << name << " | expected true\n";
+}
+
+static void check_false(const char* name, bool cond)
+{
+    std::cout << (!cond ? "[OK]   " : "[FAIL] ") << name << " | expected false\n";
+}
+
+template <typename Strategy>
+using BaseCache = cache::Base<int, int, Strategy>;
+
+static void test_grow()
+{
+    std::cout << "\n=== grow ===\n";
+    BaseCache<cache::strategy::LRU<int, int>> c(2);
+    c.put(1, 1);
+    c.put(2, 2);
+    c.setCapacity(4);
+    check_eq("capacity() after grow", c.capacity(), std::size_t(4));
+    c.put(3, 3);
+    c.put(4, 4);
+    check_eq("size() after filling grown cache", c.size(), std::size_t(4));
+    int out{};
+    check_true("oldest entry kept after grow", c.get(1, out));
+    c.put(5, 5);
+    check_eq("size() bounded by new capacity", c.size(), std::size_t(4));
+    check_false("LRU victim evicted", c.contains(2));
+}
+
+static void test_small_shrink()
+{
+    std::cout << "\n=== small shrink ===\n";
+    BaseCache<cache::strategy::LRU<int, int>> c(8);
+    for (int i = 0; i < 8; ++i)
+    {
+        c.put(i, i);
+    }
+    int out{};
+    (void) c.get(0, out);
+    c.setCapacity(4);
+    check_eq("capacity() after shrink", c.capacity(), std::size_t(4));
+    check_eq("size() trimmed immediately", c.size(), std::size_t(4));
+    check_true("recently used key survives", c.contains(0));
+    check_false("least recently used key evicted", c.contains(1));
+    check_true("newest key survives", c.contains(7));
+}
+
+static void test_incremental_shrink()
+{
+    std::cout << "\n=== incremental shrink ===\n";
+    BaseCache<cache::strategy::LRU<int, int>> c(1000);
+    for (int i = 0; i < 1000; ++i)
+    {
+        c.put(i, i);
+    }
+    c.setCapacity(10);
+    check_true("shrink bounded to one batch", c.size() > 10 && c.size() < 1000);
+
+    int out{};
+    for (int i = 0; i < 20 && c.size() > 10; ++i)
+    {
+        (void) c.get(-1, out);
+    }
+    check_eq("size() converges through get()", c.size(), std::size_t(10));
+
+    c.put(5000, 5000);
+    check_eq("size() stays at capacity after put()", c.size(), std::size_t(10));
+    check_true("newest key present", c.contains(5000));
+    check_true("recent key present", c.contains(999));
+    check_false("old key evicted", c.contains(0));
+}
+
+static void test_put_while_shrinking()
+{
+    std::cout << "\n=== put while shrinking ===\n";
+    BaseCache<cache::strategy::FIFO<int, int>> c(500);
+    for (int i = 0; i < 500; ++i)
+    {
+        c.put(i, i);
+    }
+    c.setCapacity(5);
+    for (int i = 1000; i < 1020; ++i)
+    {
+        c.put(i, i);
+    }
+    check_eq("size() converges through put()", c.size(), std::size_t(5));
+    int out{};
+    check_true("last insert kept", c.get(1019, out));
+    check_eq("last insert value", out, 1019);
+}
+
+template <typename Strategy>
+static void test_strategy_after_shrink(const char* name)
+{
+    std::cout << "\n=== " << name << " after shrink ===\n";
+    BaseCache<Strategy> c(64);
+    for (int i = 0; i < 64; ++i)
+    {
+        c.put(i, i);
+        int out{};
+        (void) c.get(i, out);
+    }
+    c.setCapacity(8);
+    for (int i = 100; i < 200; ++i)
+    {
+        c.put(i, i);
+    }
+    check_eq("size() at new capacity", c.size(), std::size_t(8));
+    c.setCapacity(16);
+    for (int i = 200; i < 300; ++i)
+    {
+        c.put(i, i);
+    }
+    check_eq("size() at regrown capacity", c.size(), std::size_t(16));
+}
+
+static void test_shrink_rehash()
+{
+    std::cout << "\n=== rehash after shrink ===\n";
+    std::unordered_map<int, int> map;
+    map.reserve(4096);
+    for (int i = 0; i < 2048; ++i)
+    {
+        map.emplace(i, i);
+    }
+    const std::size_t buckets = map.bucket_count();
+    cache::memory::shrink(map, 2048);
+    check_eq("small slack keeps the buckets", map.bucket_count(), buckets);
+
+    for (int i = 16; i < 2048; ++i)
+    {
+        map.erase(i);
+    }
+    cache::memory::shrink(map, 16);
+    check_true("large slack is rehashed away", map.bucket_count() < buckets / 4);
+    check_eq("entries kept", map.size(), std::size_t(16));
+}
+
+static void test_invalid()
+{
+    std::cout << "\n=== invalid capacity ===\n";
+    BaseCache<cache::strategy::LRU<int, int>> c(4);
+    bool                                      thrown = false;
+    try
+    {
+        c.setCapacity(0);
+    }
+    catch (const std::invalid_argument&)
+    {
+        thrown = true;
+    }
+    check_true("setCapacity(0) throws", thrown);
+    check_eq("capacity() unchanged", c.capacity(), std::size_t(4));
+}
+
+static void test_fragmented()
+{
+    std::cout << "\n=== fragmented ===\n";
+    using Cache = cache::Fragmented<int, int, cache::strategy::LRU<int, int>, std::hash<int>, std::equal_to<int>, std::shared_mutex, std::mutex>;
+    Cache c(4, 64);
+    for (int i = 0; i < 64; ++i)
+    {
+        c.put(i, i);
+    }
+    c.setCapacity(8);
+    check_eq("capacity() after shrink", c.capacity(), std::size_t(8));
+    check_eq("fragments trimmed", c.size(), std::size_t(8));
+    for (int i = 100; i < 104; ++i)
+    {
+        c.put(i, i);
+    }
+    check_eq("new fragment puts stay bounded", c.size(), std::size_t(8));
+
+    c.setCapacity(32);
+    for (int i = 200; i < 300; ++i)
+    {
+        c.put(i, i);
+    }
+    check_eq("size() after regrow", c.size(), std::size_t(32));
+}
+
+static void test_shared()
+{
+    std::cout << "\n=== shared ===\n";
+    using SharedCache = cache::Shared<int, int, cache::strategy::LRU<int, int>>;
+    auto& c = SharedCache::getInstance();
+    c.initialize(16);
+    for (int i = 0; i < 16; ++i)
+    {
+        c.put(i, i);
+    }
+    c.setCapacity(4);
+    check_eq("shared capacity()", c.capacity(), std::size_t(4));
+    check_eq("shared size()", c.size(), std::size_t(4));
+
+    using SharedFragmentedCache = cache::SharedFragmented<int, int, cache::strategy::LRU<int, int>>;
+    auto& f = SharedFragmentedCache::getInstance();
+    f.initialize(2, 16);
+    for (int i = 0; i < 16; ++i)
+    {
+        f.put(i, i);
+    }
+    f.setCapacity(4);
+    check_eq("shared fragmented capacity()", f.capacity(), std::size_t(4));
+    check_eq("shared fragmented size()", f.size(), std::size_t(4));
+}
+
+int main()
+{
+    test_grow();
+    test_small_shrink();
+    test_incremental_shrink();
+    test_put_while_shrinking();
+    test_strategy_after_shrink<cache::strategy::LFU<int, int>>("LFU");
+    test_strategy_after_shrink<cache::strategy::RedisLFU<int, int>>("RedisLFU");
+    test_strategy_after_shrink<cache::strategy::SLRU<int, int>>("SLRU");
+    test_strategy_after_shrink<cache::strategy::TwoQueues<int, int>>("2Q");
+    test_shrink_rehash();
+    test_invalid();
+    test_fragmented();
+    test_shared();
+
+    std::cout << "\nAll capacity resize tests done.\n";
+    return 0;
+}
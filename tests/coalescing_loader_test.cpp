@@ -0,0 +1,192 @@
+// Coalescing loader tests: concurrent misses are combined into bulk loads, each caller getting its own result.
+#include <Cache/Base.hpp>
+#include <Cache/Stats/CacheStats.hpp>
+#include <Cache/Store/Backed.hpp>
+#include <Cache/Store/CoalescingLoader.hpp>
+#include <atomic>
+#include <chrono>
+#include <iostream>
+#include <memory>
+#include <mutex>
+#include <span>
+#include <stdexcept>
+#include <string>
+#include <thread>
+#include <vector>
+
+// Shared check helpers
+template <typename T>
+static void check_eq(const char* name, const T& got, const T& expected)
+{
+    if (got == expected)
+    {
+        std::cout << "[OK]   " << name << " | got=" << got << " expected=" << expected << "\n";
+    }
+    else
+    {
+        std::cout << "[FAIL] " << name << " | got=" << got << " expected=" << expected << "\n";
+    }
+}
+
+static void check_true(const char* name, bool cond)
+{
+    std::cout << (cond ? "[OK]   " : "[FAIL] ") << name << " | expected true\n";
+}
+
+// Backend whose multi-key requests cost about as much as single ones.
+class BulkBackend final : public cache::store::ILoader<int, std::string>
+{
+  public:
+    std::optional<std::string> load(const int& key) override
+    {
+        ++singleCalls;
+        return value(key);
+    }
+
+    std::vector<std::optional<std::string>> loadAll(std::span<const int> keys) override
+    {
+        ++bulkCalls;
+        keysRequested += static_cast<int>(keys.size());
+        std::this_thread::sleep_for(std::chrono::milliseconds(5));
+        if (fail)
+        {
+            throw std::runtime_error("backend down");
+        }
+        std::vector<std::optional<std::string>> res;
+        for (int key : keys)
+        {
+            res.push_back(value(key));
+        }
+        return res;
+    }
+
+    static std::optional<std::string> value(int key)
+    {
+        return key < 0 ? std::nullopt : std::optional<std::string>("v" + std::to_string(key));
+    }
+
+    std::atomic<int>  singleCalls{0};
+    std::atomic<int>  bulkCalls{0};
+    std::atomic<int>  keysRequested{0};
+    std::atomic<bool> fail{false};
+};
+
+using Loader = cache::store::CoalescingLoader<int, std::string>;
+
+// Runs `threads` threads, each calling `fn(index)` once after a common start signal.
+template <typename F>
+static void concurrently(int threads, F fn)
+{
+    std::atomic<bool>        go{false};
+    std::vector<std::thread> pool;
+    for (int t = 0; t < threads; ++t)
+    {
+        pool.emplace_back([&go, &fn, t] {
+            while (!go.load())
+            {
+                std::this_thread::yield();
+            }
+            fn(t);
+        });
+    }
+    go = true;
+    for (auto& thread : pool)
+    {
+        thread.join();
+    }
+}
+
+static void test_concurrent_misses()
+{
+    std::cout << "\n=== concurrent misses ===\n";
+    auto                              backend = std::make_shared<BulkBackend>();
+    auto                              loader  = std::make_shared<Loader>(backend, cache::store::Batching{64, std::chrono::milliseconds(20)});
+    cache::Base<int, std::string>     c(1024);
+    cache::store::Backed<decltype(c)> backed(c, loader, nullptr);
+    std::atomic<int>                  correct{0};
+    concurrently(32, [&](int t) {
+        std::string out;
+        if (backed.get(t, out) && out == "v" + std::to_string(t))
+        {
+            ++correct;
+        }
+    });
+    check_eq("every thread got its own value", correct.load(), 32);
+    check_true("misses combined into few bulk calls", backend->bulkCalls.load() < 8);
+    check_eq("no single-key call", backend->singleCalls.load(), 0);
+    check_eq("batches counted", loader->batches(), static_cast<std::uint64_t>(backend->bulkCalls.load()));
+    check_eq("results cached", c.size(), std::size_t(32));
+}
+
+static void test_shared_keys()
+{
+    std::cout << "\n=== same key from several threads ===\n";
+    auto             backend = std::make_shared<BulkBackend>();
+    Loader           loader(backend, {64, std::chrono::milliseconds(20)});
+    std::atomic<int> correct{0};
+    concurrently(16, [&](int t) {
+        const int key = t % 4;
+        if (loader.load(key) == BulkBackend::value(key))
+        {
+            ++correct;
+        }
+    });
+    check_eq("every caller answered", correct.load(), 16);
+    check_true("each key requested once per batch", backend->keysRequested.load() <= 4 * backend->bulkCalls.load());
+    check_true("absent key reported", !loader.load(-1).has_value());
+}
+
+static void test_full_batch()
+{
+    std::cout << "\n=== full batch ===\n";
+    auto       backend = std::make_shared<BulkBackend>();
+    Loader     loader(backend, {4, std::chrono::seconds(5)});
+    const auto start = std::chrono::steady_clock::now();
+    concurrently(4, [&](int t) { (void) loader.load(t); });
+    check_true("full batch loaded without waiting out the window", std::chrono::steady_clock::now() - start < std::chrono::seconds(2));
+    check_eq("one bulk call", backend->bulkCalls.load(), 1);
+}
+
+static void test_failure()
+{
+    std::cout << "\n=== failure ===\n";
+    auto             backend = std::make_shared<BulkBackend>();
+    Loader           loader(backend, {64, std::chrono::milliseconds(20)});
+    std::atomic<int> failed{0};
+    backend->fail = true;
+    concurrently(8, [&](int t) {
+        try
+        {
+            (void) loader.load(t);
+        }
+        catch (const std::runtime_error&)
+        {
+            ++failed;
+        }
+    });
+    check_eq("every waiter sees the bulk failure", failed.load(), 8);
+    backend->fail = false;
+    check_true("later loads succeed", loader.load(1) == BulkBackend::value(1));
+
+    bool threw = false;
+    try
+    {
+        Loader bad(backend, {0, std::chrono::milliseconds(1)});
+    }
+    catch (const std::invalid_argument&)
+    {
+        threw = true;
+    }
+    check_true("null batch size rejected", threw);
+}
+
+int main()
+{
+    test_concurrent_misses();
+    test_shared_keys();
+    test_full_batch();
+    test_failure();
+
+    std::cout << "\nAll coalescing loader tests done.\n";
+    return 0;
+}
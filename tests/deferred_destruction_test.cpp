@@ -0,0 +1,169 @@
+// Deferred destruction tests: entries dropped by the cache are destroyed after its lock is released.
+#include <Cache/Base.hpp>
+#include <Cache/Strategy/LRU.hpp>
+#include <iostream>
+#include <mutex>
+#include <string>
+#include <utility>
+
+// Shared check helpers
+template <typename T>
+static void check_eq(const char* name, const T& got, const T& expected)
+{
+    if (got == expected)
+    {
+        std::cout << "[OK]   " << name << " | got=" << got << " expected=" << expected << "\n";
+    }
+    else
+    {
+        std::cout << "[FAIL] " << name << " | got=" << got << " expected=" << expected << "\n";
+    }
+}
+
+static void check_true(const char* name, bool cond)
+{
+    std::cout << (cond ? "[OK]   " : "[FAIL] ") << name << " | expected true\n";
+}
+
+// Exclusive mutex that remembers whether the current thread holds it.
+struct TrackingMutex
+{
+    static inline thread_local bool held = false;
+
+    void lock()
+    {
+        _mtx.lock();
+        held = true;
+    }
+
+    void unlock()
+    {
+        held = false;
+        _mtx.unlock();
+    }
+
+    bool try_lock()
+    {
+        held = _mtx.try_lock();
+        return held;
+    }
+
+    std::mutex _mtx;
+};
+
+static int destroyed       = 0;
+static int destroyedInLock = 0;
+
+// Value whose destructor records whether it ran under the cache lock.
+struct Probe
+{
+    Probe() = default;
+
+    explicit Probe(int v) : value(std::to_string(v))
+    { }
+
+    Probe(const Probe&)            = default;
+    Probe& operator=(const Probe&) = default;
+
+    Probe(Probe&& other) noexcept : value(std::move(other.value)), live(std::exchange(other.live, false))
+    { }
+
+    Probe& operator=(Probe&& other) noexcept
+    {
+        value = std::move(other.value);
+        live  = std::exchange(other.live, false);
+        return *this;
+    }
+
+    ~Probe()
+    {
+        if (live)
+        {
+            ++destroyed;
+            destroyedInLock += TrackingMutex::held ? 1 : 0;
+        }
+    }
+
+    std::string value;
+    bool        live = true;
+};
+
+using Cache = cache::Base<std::string, Probe, cache::strategy::LRU<std::string, Probe>, std::hash<std::string>, std::equal_to<std::string>, TrackingMutex>;
+
+static void reset()
+{
+    destroyed       = 0;
+    destroyedInLock = 0;
+}
+
+static void test_evictions()
+{
+    std::cout << "\n=== evictions ===\n";
+    Cache c(8);
+    for (int i = 0; i < 8; ++i)
+    {
+        c.put(std::to_string(i), Probe(i));
+    }
+    reset();
+    for (int i = 8; i < 20; ++i)
+    {
+        c.put(std::to_string(i), Probe(i));
+    }
+    // Each put also destroys its argument, outside the lock.
+    check_eq("evicted values destroyed", destroyed, 12 + 12);
+    check_eq("none under the lock", destroyedInLock, 0);
+}
+
+static void test_remove_invalidate_clear()
+{
+    std::cout << "\n=== remove, invalidation, resize and clear ===\n";
+    Cache c(32);
+    for (int i = 0; i < 32; ++i)
+    {
+        c.put(std::to_string(i), Probe(i));
+    }
+
+    reset();
+    c.remove("3");
+    check_eq("removed value destroyed", destroyed, 1);
+
+    c.invalidateIf([](const std::string& key, const Probe&) { return key == "4"; });
+    Probe out;
+    check_true("invalidated entry misses", !c.get("4", out));
+    c.clearInvalidationPredicate();
+    check_eq("invalidated value destroyed", destroyed, 2);
+
+    c.setCapacity(20);
+    check_eq("entries trimmed by the shrink destroyed", destroyed, 2 + 10);
+    c.put("fresh", Probe(100));
+    check_eq("victim and argument of the next put destroyed", destroyed, 2 + 10 + 2);
+
+    c.clear();
+    check_eq("cleared values destroyed", destroyed, 2 + 10 + 2 + 20);
+    check_eq("none under the lock", destroyedInLock, 0);
+}
+
+static void test_values_survive()
+{
+    std::cout << "\n=== values intact ===\n";
+    Cache c(4);
+    for (int i = 0; i < 100; ++i)
+    {
+        c.put(std::to_string(i), Probe(i));
+    }
+    Probe out;
+    check_true("latest entry present", c.get("99", out));
+    check_eq("latest value", out.value, std::string("99"));
+    check_true("evicted entry gone", !c.get("0", out));
+    check_eq("size bounded", c.size(), std::size_t(4));
+}
+
+int main()
+{
+    test_evictions();
+    test_remove_invalidate_clear();
+    test_values_survive();
+
+    std::cout << "\nAll deferred destruction tests done.\n";
+    return 0;
+}
@@ -3,6 +3,7 @@
 #include <Cache/Helpers/MutexLocks.hpp>
 #include <Cache/Strategy/2Q.hpp>
 #include <Cache/Strategy/FIFO.hpp>
+#include <Cache/Strategy/Interfaces/StrategyAdapter.hpp>
 #include <Cache/Strategy/LRU.hpp>
 #include <Cache/Strategy/MRU.hpp>
 #include <Cache/Strategy/SLRU.hpp>
@@ -150,6 +151,42 @@ static void test_policy(const std::string& label)
     }
 }
 
+static void test_adapter()
+{
+    using K       = int;
+    using V       = int;
+    using Adapter = cache::strategy::StrategyAdapter<cache::strategy::LRU<K, V>>;
+
+    std::cout << "\n=== LRU through ICacheStrategy adapter ===\n";
+
+    Adapter                                adapter;
+    cache::strategy::ICacheStrategy<K, V>& dyn = adapter;
+    dyn.reserve(3);
+    check_true("onInsert(1)", dyn.onInsert(1));
+    check_true("onInsert(2)", dyn.onInsert(2));
+    check_true("onAccess(1)", dyn.onAccess(1));
+    check_eq("victim through vtable", dyn.selectForEviction().value_or(-1), 2);
+
+    cache::Base<K, V, Adapter, std::hash<K>, std::equal_to<K>, cache::mutex_locks::NoLock> c(2);
+    c.put(1, 100);
+    c.put(2, 200);
+    V out{};
+    (void) c.get(1, out);
+    c.put(3, 300);
+    check_false("adapter-backed Base: key 2 evicted", c.get(2, out));
+    check_true("adapter-backed Base: key 1 remains", c.get(1, out));
+
+    using Strings = cache::strategy::StrategyAdapter<cache::strategy::LRU<std::string, int>>;
+    Strings strings;
+    strings.reserve(4);
+    check_true("adapter keeps temporary key", strings.onInsert(std::string(40, 'a')));
+    check_true("second temporary key", strings.onInsert(std::string(40, 'b')));
+    check_true("access by an equal key", strings.onAccess(std::string(40, 'a')));
+    check_eq("victim read from the adapter's copy", strings.selectForEviction().value_or(""), std::string(40, 'b'));
+    check_true("remove by an equal key", strings.onRemove(std::string(40, 'b')));
+    check_eq("remaining victim", strings.selectForEviction().value_or(""), std::string(40, 'a'));
+}
+
 int main()
 {
     test_policy<cache::strategy::LRU<int, int>>("LRU");
@@ -157,6 +194,7 @@ int main()
     test_policy<cache::strategy::FIFO<int, int>>("FIFO");
     test_policy<cache::strategy::TwoQueues<int, int>>("2Q");
     test_policy<cache::strategy::SLRU<int, int>>("SLRU");
+    test_adapter();
     std::cout << "\nAll tests done.\n";
     return 0;
 }
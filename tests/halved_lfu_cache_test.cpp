@@ -132,6 +132,28 @@ int main()
         check_true("present 4", cache.get(4, out));
     }
 
+    // ---- Test 4: Untouched keys are decayed by the incremental sweep ----
+    // Key 0 is never accessed again after its hot phase, so only the bounded per-op
+    // sweep can bring its frequency down.
+    {
+        std::cout << "\n=== HalvedLFU: incremental sweep decays idle keys ===\n";
+        Cache cache(1000);
+        for (int k = 0; k < 1000; ++k)
+            cache.put(k, k);
+
+        int out{};
+        for (int i = 0; i < 2000; ++i)
+            (void) cache.get(0, out);
+
+        for (int i = 0; i < 60000; ++i)
+            (void) cache.get(1 + (i % 999), out);
+
+        cache.put(1000, 1000);
+        check_false("idle hot key 0 decayed and evicted", cache.get(0, out));
+        check_true("1000 present", cache.get(1000, out));
+        check_eq("size() stays at capacity", cache.size(), std::size_t(1000));
+    }
+
     std::cout << "\nAll HalvedLFU tests done.\n";
     return 0;
 }
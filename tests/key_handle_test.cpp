@@ -0,0 +1,128 @@
+// Strategy key handle tests: strategies borrow non-trivial keys from the cache.
+#include <Cache/Base.hpp>
+#include <Cache/Helpers/KeyHandle.hpp>
+#include <Cache/Strategy/2Q.hpp>
+#include <Cache/Strategy/FIFO.hpp>
+#include <Cache/Strategy/HalvedLFU.hpp>
+#include <Cache/Strategy/LFU.hpp>
+#include <Cache/Strategy/LRU.hpp>
+#include <Cache/Strategy/MRU.hpp>
+#include <Cache/Strategy/RedisLFU.hpp>
+#include <Cache/Strategy/SLRU.hpp>
+#include <iostream>
+#include <string>
+#include <type_traits>
+
+// Shared check helpers
+template <typename T>
+static void check_eq(const char* name, const T& got, const T& expected)
+{
+    if (got == expected)
+    {
+        std::cout << "[OK]   " << name << " | got=" << got << " expected=" << expected << "\n";
+    }
+    else
+    {
+        std::cout << "[FAIL] " << name << " | got=" << got << " expected=" << expected << "\n";
+    }
+}
+
+static void check_true(const char* name, bool cond)
+{
+    std::cout << (cond ? "[OK]   " : "[FAIL] ") << name << " | expected true\n";
+}
+
+static void check_false(const char* name, bool cond)
+{
+    std::cout << (!cond ? "[OK]   " : "[FAIL] ") << name << " | expected false\n";
+}
+
+static void test_traits()
+{
+    std::cout << "\n=== handle traits ===\n";
+    check_false("int keys are copied", cache::keys::borrowed<int>);
+    check_false("pointer-sized keys are copied", cache::keys::borrowed<std::uint64_t>);
+    check_true("string keys are borrowed", cache::keys::borrowed<std::string>);
+    check_true("string handle is a pointer", std::is_same_v<cache::keys::Handle<std::string>, const std::string*>);
+
+    const std::string key = "abc";
+    check_true("handle() points at the key", cache::keys::handle(key) == &key);
+    check_eq("get() reads through the handle", cache::keys::get<std::string>(cache::keys::handle(key)), key);
+    check_eq("transparent hash matches std::hash", cache::keys::Hash<std::string>{}(&key), std::hash<std::string>{}(key));
+}
+
+static std::string makeKey(int i)
+{
+    return "key-" + std::to_string(i) + std::string(40, 'x');
+}
+
+// Churns a string-keyed cache through inserts, hits, updates, evictions, removals,
+// invalidations and clears; every strategy must only ever see live keys.
+template <typename Strategy>
+static void test_churn(const char* name)
+{
+    std::cout << "\n=== " << name << " with borrowed keys ===\n";
+    cache::Base<std::string, int, Strategy> c(32);
+    int                                     out{};
+    bool                                    consistent = true;
+    for (int i = 0; i < 2000; ++i)
+    {
+        c.put(makeKey(i % 97), i);
+        if (c.get(makeKey(i % 89), out))
+        {
+            consistent = consistent && out % 97 == (i % 89) % 97;
+        }
+        if (i % 7 == 0)
+        {
+            c.remove(makeKey(i % 53));
+        }
+        if (i == 1000)
+        {
+            c.invalidateIf([](const std::string& k, const int&) { return k.size() % 2 == 0; });
+        }
+        if (i == 1500)
+        {
+            c.clearInvalidationPredicate();
+            c.clear();
+        }
+        consistent = consistent && c.size() <= 32;
+    }
+    check_true("values match their keys and size stays bounded", consistent);
+
+    c.put(makeKey(5000), 5000);
+    check_true("fresh key readable", c.get(makeKey(5000), out));
+    check_eq("fresh key value", out, 5000);
+}
+
+static void test_key_memory_paid_once()
+{
+    std::cout << "\n=== strategy overhead independent of key length ===\n";
+    cache::Base<std::string, int> shortKeys(64);
+    cache::Base<std::string, int> longKeys(64);
+    for (int i = 0; i < 64; ++i)
+    {
+        shortKeys.put(std::to_string(i), i);
+        longKeys.put(std::to_string(i) + std::string(200, 'x'), i);
+    }
+    const auto s = shortKeys.memoryUsage();
+    const auto l = longKeys.memoryUsage();
+    check_eq("same overhead for short and long keys", l.overheadBytes, s.overheadBytes);
+    check_true("long keys only grow the payload", l.payloadBytes >= s.payloadBytes + 64 * 200);
+}
+
+int main()
+{
+    test_traits();
+    test_churn<cache::strategy::LRU<std::string, int>>("LRU");
+    test_churn<cache::strategy::MRU<std::string, int>>("MRU");
+    test_churn<cache::strategy::FIFO<std::string, int>>("FIFO");
+    test_churn<cache::strategy::LFU<std::string, int>>("LFU");
+    test_churn<cache::strategy::HalvedLFU<std::string, int>>("HalvedLFU");
+    test_churn<cache::strategy::RedisLFU<std::string, int>>("RedisLFU");
+    test_churn<cache::strategy::SLRU<std::string, int>>("SLRU");
+    test_churn<cache::strategy::TwoQueues<std::string, int>>("2Q");
+    test_key_memory_paid_once();
+
+    std::cout << "\nAll key handle tests done.\n";
+    return 0;
+}
@@ -117,6 +117,39 @@ int main()
         // We won't assert here because it depends on your chosen put() semantics.
     }
 
+    // --------------- Test 4: Sparse frequencies and node reuse ---------------
+    {
+        std::cout << "\n=== LFU: sparse frequencies, remove and reuse ===\n";
+        Cache cache(4);
+
+        cache.put(1, 100);
+        cache.put(2, 200);
+        cache.put(3, 300);
+        cache.put(4, 400);
+
+        int out{};
+        for (int i = 0; i < 3; ++i)
+            (void) cache.get(1, out); // 1:4
+        (void) cache.get(2, out);     // 2:2
+        (void) cache.get(3, out);     // 3:2
+        (void) cache.get(3, out);     // 3:3
+
+        cache.put(5, 500); // evicts 4 (only key at freq=1)
+        check_false("key 4 evicted (freq=1)", cache.get(4, out));
+
+        cache.remove(2);
+        cache.put(6, 600); // 5 and 6 both at freq=1, 5 is older
+        cache.put(7, 700); // evicts 5
+
+        check_false("key 5 evicted (LRU within freq=1)", cache.get(5, out));
+        check_true("key 1 survives (freq=4)", cache.get(1, out));
+        check_eq("value for key 1", out, 100);
+        check_true("key 3 survives (freq=3)", cache.get(3, out));
+        check_true("key 6 present", cache.get(6, out));
+        check_true("key 7 present", cache.get(7, out));
+        check_eq("size() after churn", cache.size(), std::size_t(4));
+    }
+
     std::cout << "\nAll LFU tests done.\n";
     return 0;
 }
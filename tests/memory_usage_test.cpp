@@ -0,0 +1,181 @@
+// Memory accounting tests.
+#include <Cache/Base.hpp>
+#include <Cache/Fragmented.hpp>
+#include <Cache/Memory/CountingResource.hpp>
+#include <Cache/Shared.hpp>
+#include <Cache/Strategy/2Q.hpp>
+#include <Cache/Strategy/FIFO.hpp>
+#include <Cache/Strategy/HalvedLFU.hpp>
+#include <Cache/Strategy/LFU.hpp>
+#include <Cache/Strategy/LRU.hpp>
+#include <Cache/Strategy/MRU.hpp>
+#include <Cache/Strategy/RedisLFU.hpp>
+#include <Cache/Strategy/SLRU.hpp>
+#include <array>
+#include <iostream>
+#include <memory_resource>
+#include <mutex>
+#include <shared_mutex>
+#include <string>
+#include <string_view>
+#include <vector>
+
+// Shared check helpers
+template <typename T>
+static void check_eq(const char* name, const T& got, const T& expected)
+{
+    if (got == expected)
+    {
+        std::cout << "[OK]   " << name << " | got=" << got << " expected=" << expected << "\n";
+    }
+    else
+    {
+        std::cout << "[FAIL] " << name << " | got=" << got << " expected=" << expected << "\n";
+    }
+}
+
+static void check_true(const char* name, bool cond)
+{
+    std::cout << (cond ? "[OK]   " : "[FAIL] ") << name << " | expected true\n";
+}
+
+static void test_counting_resource()
+{
+    std::cout << "\n=== counting resource ===\n";
+    cache::memory::CountingResource res;
+    {
+        std::pmr::vector<int> v(&res);
+        v.reserve(100);
+        check_eq("bytes() after reserve", res.bytes(), sizeof(int) * 100);
+        check_eq("blocks() after reserve", res.blocks(), std::size_t(1));
+    }
+    check_eq("bytes() after release", res.bytes(), std::size_t(0));
+    check_eq("blocks() after release", res.blocks(), std::size_t(0));
+    check_eq("peakBytes() remembers the high mark", res.peakBytes(), sizeof(int) * 100);
+}
+
+static void test_heap_bytes()
+{
+    std::cout << "\n=== heap bytes ===\n";
+    check_eq("int owns no heap", cache::memory::heapBytes(42), std::size_t(0));
+    check_eq("string owns its characters and terminator", cache::memory::heapBytes(std::string(100, 'x')), std::size_t(101));
+    check_eq("short string kept inline", cache::memory::heapBytes(std::string("abc")), std::size_t(0));
+    check_eq("vector owns its elements", cache::memory::heapBytes(std::vector<double>(10)), sizeof(double) * 10);
+    std::vector<int> reserved;
+    reserved.reserve(64);
+    check_eq("counted by capacity", cache::memory::heapBytes(reserved), sizeof(int) * 64);
+    check_eq("array is inline", cache::memory::heapBytes(std::array<int, 16>{}), std::size_t(0));
+    check_eq("string_view owns nothing", cache::memory::heapBytes(std::string_view("a view on a long enough string")), std::size_t(0));
+}
+
+static void test_base_trivial()
+{
+    std::cout << "\n=== Base<int, int> ===\n";
+    cache::Base<int, int> c(64);
+    const auto            empty = c.memoryUsage();
+    check_eq("empty payload", empty.payloadBytes, std::size_t(0));
+    check_true("empty overhead counts buckets and the object", empty.overheadBytes >= sizeof(c));
+
+    for (int i = 0; i < 64; ++i)
+    {
+        c.put(i, i);
+    }
+    const auto full = c.memoryUsage();
+    check_eq("payload is the inline keys and values", full.payloadBytes, 64 * (sizeof(int) + sizeof(int)));
+    check_true("overhead grows with the entries", full.overheadBytes > empty.overheadBytes);
+    check_true("one map node and strategy nodes per entry", full.allocations >= 64 * 3);
+    check_eq("total()", full.total(), full.payloadBytes + full.overheadBytes);
+
+    c.clear();
+    const auto cleared = c.memoryUsage();
+    check_eq("payload after clear", cleared.payloadBytes, std::size_t(0));
+    check_true("nodes released on clear", cleared.allocations < full.allocations);
+}
+
+static void test_base_strings()
+{
+    std::cout << "\n=== Base<string, string> ===\n";
+    cache::Base<std::string, std::string> c(16);
+    const std::string                     key(100, 'k');
+    c.put(key, std::string(1000, 'v'));
+    const auto usage = c.memoryUsage();
+    check_eq("payload includes heap contents", usage.payloadBytes, 2 * sizeof(std::string) + 101 + 1001);
+    check_true("strategy key copies are counted as overhead", usage.overheadBytes >= 2 * 100);
+}
+
+static void test_base_pmr_strings()
+{
+    std::cout << "\n=== Base<int, pmr::string> ===\n";
+    cache::Base<int, std::pmr::string, cache::strategy::LRU<int, std::pmr::string>> c(16);
+    c.put(1, std::pmr::string(10000, 'v'));
+    const auto usage = c.memoryUsage();
+    check_eq("payload includes the value buffer", usage.payloadBytes, sizeof(int) + sizeof(std::pmr::string) + 10001);
+    check_true("value buffer not counted again as overhead", usage.overheadBytes < 10000);
+}
+
+template <typename Strategy>
+static void test_strategy(const char* name)
+{
+    std::cout << "\n=== " << name << " ===\n";
+    Strategy s;
+    s.reserve(32);
+    const auto empty = s.memoryUsage();
+    for (int i = 0; i < 32; ++i)
+    {
+        (void) s.onInsert(i);
+        (void) s.onAccess(i);
+    }
+    const auto full = s.memoryUsage();
+    check_true("strategy bytes grow with inserts", full.overheadBytes > empty.overheadBytes);
+    check_true("strategy blocks grow with inserts", full.allocations > empty.allocations);
+    check_eq("strategy has no payload", full.payloadBytes, std::size_t(0));
+    s.onClear();
+    check_true("strategy bytes released on clear", s.memoryUsage().overheadBytes < full.overheadBytes);
+}
+
+static void test_fragmented()
+{
+    std::cout << "\n=== Fragmented ===\n";
+    using Cache = cache::Fragmented<int, int, cache::strategy::LRU<int, int>, std::hash<int>, std::equal_to<int>, std::shared_mutex, std::mutex>;
+    Cache c(4, 64);
+    for (int i = 0; i < 64; ++i)
+    {
+        c.put(i, i);
+    }
+    const auto usage = c.memoryUsage();
+    check_eq("fragmented payload sums fragments", usage.payloadBytes, 64 * (sizeof(int) + sizeof(int)));
+    check_true("fragmented overhead includes fragments", usage.overheadBytes > sizeof(c));
+}
+
+static void test_shared()
+{
+    std::cout << "\n=== Shared ===\n";
+    using SharedCache = cache::Shared<int, int, cache::strategy::LRU<int, int>>;
+    auto& c           = SharedCache::getInstance();
+    check_eq("uninitialized shared payload", c.memoryUsage().payloadBytes, std::size_t(0));
+    c.initialize(8);
+    c.put(1, 1);
+    check_eq("shared payload forwards", c.memoryUsage().payloadBytes, sizeof(int) + sizeof(int));
+}
+
+int main()
+{
+    test_counting_resource();
+    test_heap_bytes();
+    test_base_trivial();
+    test_base_strings();
+    test_base_pmr_strings();
+    test_strategy<cache::strategy::LRU<int, int>>("LRU");
+    test_strategy<cache::strategy::MRU<int, int>>("MRU");
+    test_strategy<cache::strategy::FIFO<int, int>>("FIFO");
+    test_strategy<cache::strategy::LFU<int, int>>("LFU");
+    test_strategy<cache::strategy::HalvedLFU<int, int>>("HalvedLFU");
+    test_strategy<cache::strategy::RedisLFU<int, int>>("RedisLFU");
+    test_strategy<cache::strategy::SLRU<int, int>>("SLRU");
+    test_strategy<cache::strategy::TwoQueues<int, int>>("2Q");
+    test_fragmented();
+    test_shared();
+
+    std::cout << "\nAll memory usage tests done.\n";
+    return 0;
+}
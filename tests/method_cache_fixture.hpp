@@ -8,6 +8,7 @@
 #include <Cache/Strategy/LRU.hpp>
 #include <chrono>
 #include <iostream>
+#include <string_view>
 #include <thread>
 
 class Vector
@@ -16,10 +17,19 @@ class Vector
     constexpr explicit Vector(double x, double y, double z) : x(x), y(y), z(z)
     { }
 
+    using InterceptKey   = cache::MethodCacheKey<double, double, double, double, double, double>;
+    using InterceptCache = cache::SharedFragmented<InterceptKey, double, cache::strategy::LRU<InterceptKey, double>, std::hash<InterceptKey>, std::equal_to<InterceptKey>, std::shared_mutex>;
+
+    struct InterceptTag
+    {
+        static constexpr std::string_view className  = "Vector";
+        static constexpr std::string_view methodName = "intercept";
+    };
+
     double intercept(const Vector& other)
     {
-        using KeyType = cache::MethodCacheKey<double, double, double, double, double, double>;
-        auto& cache   = cache::MethodManager<>::getInstance().getMethodCache<KeyType, double, cache::strategy::LRU<KeyType, double>, std::hash<KeyType>, std::equal_to<KeyType>, std::shared_mutex, cache::SharedFragmented<KeyType, double, cache::strategy::LRU<KeyType, double>, std::hash<KeyType>, std::equal_to<KeyType>, std::shared_mutex>>("Vector", "intercept");
+        using KeyType = InterceptKey;
+        auto& cache   = cache::MethodManager<>::getInstance().getTaggedMethodCache<InterceptTag, KeyType, double, cache::strategy::LRU<KeyType, double>, std::hash<KeyType>, std::equal_to<KeyType>, std::shared_mutex, InterceptCache>();
 
         KeyType key(x, y, z, other.x, other.y, other.z);
         double  result;
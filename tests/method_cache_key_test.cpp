@@ -0,0 +1,130 @@
+// MethodCacheKey hashing tests.
+#include <Cache/MethodCacheKey.hpp>
+#include <algorithm>
+#include <cstddef>
+#include <iostream>
+#include <limits>
+#include <string>
+#include <tuple>
+#include <unordered_set>
+#include <vector>
+
+template <typename T>
+static void check_eq(const char* name, const T& got, const T& expected)
+{
+    if (got == expected)
+    {
+        std::cout << "[OK]   " << name << " | got=" << got << " expected=" << expected << "\n";
+    }
+    else
+    {
+        std::cout << "[FAIL] " << name << " | got=" << got << " expected=" << expected << "\n";
+    }
+}
+
+static void check_true(const char* name, bool cond)
+{
+    std::cout << (cond ? "[OK]   " : "[FAIL] ") << name << " | expected true\n";
+}
+
+static void check_false(const char* name, bool cond)
+{
+    std::cout << (!cond ? "[OK]   " : "[FAIL] ") << name << " | expected false\n";
+}
+
+using VecKey = cache::MethodCacheKey<double, double, double, double, double, double>;
+
+static void test_equality_and_hash()
+{
+    std::cout << "\n=== MethodCacheKey: equality and cached hash ===\n";
+    VecKey a(1.0, 2.0, 3.0, 4.0, 5.0, 6.0);
+    VecKey b(1.0, 2.0, 3.0, 4.0, 5.0, 6.0);
+    VecKey c(1.0, 2.0, 3.0, 4.0, 6.0, 5.0);
+
+    check_true("equal arguments compare equal", a == b);
+    check_eq("equal arguments hash equal", std::hash<VecKey>{}(a), std::hash<VecKey>{}(b));
+    check_false("swapped arguments compare different", a == c);
+    check_true("swapped arguments hash different", std::hash<VecKey>{}(a) != std::hash<VecKey>{}(c));
+    check_eq("std::hash returns the cached hash", std::hash<VecKey>{}(a), a.hash());
+
+    using MixedKey = cache::MethodCacheKey<int, std::string>;
+    MixedKey m1(7, "seven");
+    MixedKey m2(7, "seven");
+    MixedKey m3(7, "eight");
+    check_true("mixed key equality", m1 == m2);
+    check_eq("mixed key hash", m1.hash(), m2.hash());
+    check_false("mixed key inequality", m1 == m3);
+
+    using TupleKey = cache::MethodCacheKey<double, std::string>;
+    TupleKey zero(0.0, "x");
+    TupleKey negZero(-0.0, "x");
+    check_true("tuple key: -0.0 and 0.0 compare equal", zero == negZero);
+    check_eq("tuple key: -0.0 and 0.0 hash equal", zero.hash(), negZero.hash());
+    check_true("tuple key: args()", zero.args() == std::make_tuple(0.0, std::string("x")));
+}
+
+static void test_packed_key()
+{
+    std::cout << "\n=== MethodCacheKey: packed representation ===\n";
+    using PackedKey = cache::MethodCacheKey<char, double, int>;
+
+    check_eq("six doubles pack into 48 bytes", VecKey::storageSize, std::size_t(48));
+    check_eq("char+double+int pack without padding", PackedKey::packedSize, std::size_t(13));
+    check_eq("packed storage rounds to 8 bytes", PackedKey::storageSize, std::size_t(16));
+
+    PackedKey k('a', 2.5, -7);
+    check_eq("get<0>", k.get<0>(), 'a');
+    check_eq("get<1>", k.get<1>(), 2.5);
+    check_eq("get<2>", k.get<2>(), -7);
+    check_true("args() unpacks the arguments", k.args() == std::make_tuple('a', 2.5, -7));
+    check_eq("bytes() spans the storage", k.bytes().size(), PackedKey::storageSize);
+
+    PackedKey same('a', 2.5, -7);
+    check_true("equal packed keys", k == same);
+    check_eq("equal packed hashes", k.hash(), same.hash());
+    check_false("different packed keys", k == PackedKey('a', 2.5, -8));
+
+    VecKey zero(0.0, 0.0, 0.0, 0.0, 0.0, 0.0);
+    VecKey negZero(-0.0, 0.0, 0.0, 0.0, 0.0, 0.0);
+    check_false("packed key: -0.0 is a distinct argument", zero == negZero);
+
+    const double nan = std::numeric_limits<double>::quiet_NaN();
+    check_true("packed key: identical NaN bits match", VecKey(nan, 0, 0, 0, 0, 0) == VecKey(nan, 0, 0, 0, 0, 0));
+}
+
+static void test_distribution()
+{
+    std::cout << "\n=== MethodCacheKey: distribution over a coordinate grid ===\n";
+    constexpr std::size_t           buckets = 16;
+    std::vector<std::size_t>        counts(buckets, 0);
+    std::unordered_set<std::size_t> hashes;
+    std::size_t                     total = 0;
+
+    for (int x = 0; x < 40; ++x)
+    {
+        for (int y = 0; y < 40; ++y)
+        {
+            for (int z = 0; z < 40; ++z)
+            {
+                VecKey k(x, y, z, 1.0, 2.0, 3.0);
+                hashes.insert(k.hash());
+                ++counts[k.hash() % buckets];
+                ++total;
+            }
+        }
+    }
+
+    check_eq("no full 64-bit collisions", hashes.size(), total);
+    const auto [lo, hi]   = std::minmax_element(counts.begin(), counts.end());
+    const double expected = static_cast<double>(total) / buckets;
+    check_true("fragment routing within 5% of uniform", *lo > expected * 0.95 && *hi < expected * 1.05);
+}
+
+int main()
+{
+    test_equality_and_hash();
+    test_packed_key();
+    test_distribution();
+    std::cout << "\nAll MethodCacheKey tests done.\n";
+    return 0;
+}
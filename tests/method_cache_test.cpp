@@ -59,6 +59,20 @@ int main()
     check_eq("different instance hits shared cache", result3, expected);
     check_true("shared cache call faster than cold call", duration3 < duration1);
 
+    std::cout << "\n=== Tagged lookup shares the named registry entry ===\n";
+
+    using KeyType   = Vector::InterceptKey;
+    auto& manager   = cache::MethodManager<>::getInstance();
+    auto& tagged    = manager.getTaggedMethodCache<Vector::InterceptTag, KeyType, double, cache::strategy::LRU<KeyType, double>, std::hash<KeyType>, std::equal_to<KeyType>, std::shared_mutex, Vector::InterceptCache>();
+    auto& named     = manager.getMethodCache<KeyType, double, cache::strategy::LRU<KeyType, double>, std::hash<KeyType>, std::equal_to<KeyType>, std::shared_mutex, Vector::InterceptCache>("Vector", "intercept");
+    auto& taggedTwo = manager.getTaggedMethodCache<Vector::InterceptTag, KeyType, double, cache::strategy::LRU<KeyType, double>, std::hash<KeyType>, std::equal_to<KeyType>, std::shared_mutex, Vector::InterceptCache>();
+    check_true("tagged and named lookups return the same cache", static_cast<cache::IStrategyCache<KeyType, double>*>(&tagged) == &named);
+    check_true("repeated tagged lookups are stable", &tagged == &taggedTwo);
+
+    double cached{};
+    check_true("tagged handle sees values stored by intercept()", tagged.get(KeyType(1.0, 2.0, 3.0, 4.0, 5.0, 6.0), cached));
+    check_eq("tagged handle cached value", cached, expected);
+
     std::cout << "\nAll Vector intercept cache checks done.\n";
     return 0;
 }
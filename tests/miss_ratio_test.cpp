@@ -0,0 +1,146 @@
+// SHARDS miss ratio curve estimation tests.
+#include <Cache/Base.hpp>
+#include <Cache/Fragmented.hpp>
+#include <Cache/Helpers/MutexLocks.hpp>
+#include <Cache/Stats/MissRatioEstimator.hpp>
+#include <Cache/Strategy/LRU.hpp>
+#include <cmath>
+#include <cstdint>
+#include <iostream>
+#include <memory>
+#include <random>
+#include <vector>
+
+template <typename T>
+static void check_eq(const char* name, const T& got, const T& expected)
+{
+    if (got == expected)
+    {
+        std::cout << "[OK]   " << name << " | got=" << got << " expected=" << expected << "\n";
+    }
+    else
+    {
+        std::cout << "[FAIL] " << name << " | got=" << got << " expected=" << expected << "\n";
+    }
+}
+
+static void check_true(const char* name, bool cond)
+{
+    std::cout << (cond ? "[OK]   " : "[FAIL] ") << name << " | expected true\n";
+}
+
+using LruCache = cache::Base<int, int, cache::strategy::LRU<int, int>, std::hash<int>, std::equal_to<int>, cache::mutex_locks::NoLock>;
+
+static std::vector<int> zipfTrace(std::size_t keys, std::size_t length, double skew)
+{
+    std::vector<double> cdf(keys);
+    double              sum = 0;
+    for (std::size_t i = 0; i < keys; ++i)
+    {
+        sum += 1.0 / std::pow(static_cast<double>(i + 1), skew);
+        cdf[i] = sum;
+    }
+    std::mt19937_64                        rng(7);
+    std::uniform_real_distribution<double> u(0, sum);
+    std::vector<int>                       trace(length);
+    for (auto& k : trace)
+    {
+        k = static_cast<int>(std::lower_bound(cdf.begin(), cdf.end(), u(rng)) - cdf.begin());
+    }
+    return trace;
+}
+
+static double lruHitRatio(const std::vector<int>& trace, std::size_t capacity)
+{
+    LruCache      c(capacity);
+    std::uint64_t hits = 0;
+    int           out{};
+    for (int k : trace)
+    {
+        if (c.get(k, out))
+        {
+            ++hits;
+        }
+        else
+        {
+            c.put(k, k);
+        }
+    }
+    return static_cast<double>(hits) / static_cast<double>(trace.size());
+}
+
+static void test_loop_exact()
+{
+    std::cout << "\n=== MRC: cyclic loop without sampling ===\n";
+    cache::stats::MissRatioEstimator mrc(500);
+    for (int round = 0; round < 20; ++round)
+    {
+        for (int k = 0; k < 1000; ++k)
+        {
+            mrc.access(std::hash<int>{}(k));
+        }
+    }
+    auto curve = mrc.curve();
+    check_eq("four curve points", curve.size(), std::size_t(4));
+    check_eq("all keys sampled", mrc.samplingRate(), 1.0);
+    check_true("0.5x: loop larger than cache never hits", curve[0].hitRatio < 0.01);
+    check_true("1x: loop larger than cache never hits", curve[1].hitRatio < 0.01);
+    check_true("2x: everything but cold misses hits", std::abs(curve[2].hitRatio - 0.95) < 0.01);
+    check_true("4x: same as 2x", std::abs(curve[3].hitRatio - 0.95) < 0.01);
+}
+
+static void test_sampled_against_lru()
+{
+    std::cout << "\n=== MRC: sampled estimate vs LRU replay ===\n";
+    const auto trace = zipfTrace(50000, 400000, 0.9);
+
+    auto     mrc = std::make_shared<cache::stats::MissRatioEstimator>(2000, 1024);
+    LruCache c(2000);
+    c.setMissRatioEstimator(mrc);
+    int out{};
+    for (int k : trace)
+    {
+        if (!c.get(k, out))
+        {
+            c.put(k, k);
+        }
+    }
+
+    check_true("sampling rate lowered to bound memory", mrc->samplingRate() < 0.1);
+    for (const auto& point : mrc->curve())
+    {
+        const double actual = lruHitRatio(trace, point.size);
+        std::cout << "[INFO] size=" << point.size << " estimated=" << point.hitRatio << " actual=" << actual << "\n";
+        check_true("estimate within 0.05 of LRU replay", std::abs(point.hitRatio - actual) < 0.05);
+    }
+}
+
+static void test_fragmented_shared_estimator()
+{
+    std::cout << "\n=== MRC: one estimator for all fragments ===\n";
+    auto                        mrc = std::make_shared<cache::stats::MissRatioEstimator>(64);
+    cache::Fragmented<int, int> c(4, 64);
+    c.setMissRatioEstimator(mrc);
+    int out{};
+    for (int round = 0; round < 10; ++round)
+    {
+        for (int k = 0; k < 32; ++k)
+        {
+            if (!c.get(k, out))
+            {
+                c.put(k, k);
+            }
+        }
+    }
+    check_true("working set of 32 fits in 64", std::abs(mrc->hitRatioAt(64) - 0.9) < 0.01);
+    check_true("nothing fits in 8", mrc->hitRatioAt(8) < 0.01);
+}
+
+int main()
+{
+    test_loop_exact();
+    test_sampled_against_lru();
+    test_fragmented_shared_estimator();
+    std::cout << "\nAll miss ratio tests done.\n";
+    return 0;
+}
@@ -0,0 +1,243 @@
+// Removal listener tests: causes, delivery outside the cache lock, asynchronous dispatch and every container.
+#include <Cache/Base.hpp>
+#include <Cache/Fragmented.hpp>
+#include <Cache/Listener/RemovalListener.hpp>
+#include <Cache/Shared.hpp>
+#include <Cache/SharedFragmented.hpp>
+#include <Cache/Strategy/LRU.hpp>
+#include <atomic>
+#include <chrono>
+#include <iostream>
+#include <memory_resource>
+#include <mutex>
+#include <shared_mutex>
+#include <stdexcept>
+#include <string>
+#include <thread>
+#include <vector>
+
+// Shared check helpers
+template <typename T>
+static void check_eq(const char* name, const T& got, const T& expected)
+{
+    if (got == expected)
+    {
+        std::cout << "[OK]   " << name << " | got=" << got << " expected=" << expected << "\n";
+    }
+    else
+    {
+        std::cout << "[FAIL] " << name << " | got=" << got << " expected=" << expected << "\n";
+    }
+}
+
+static void check_true(const char* name, bool cond)
+{
+    std::cout << (cond ? "[OK]   " : "[FAIL] ") << name << " | expected true\n";
+}
+
+// Exclusive mutex that remembers whether the current thread holds it.
+struct TrackingMutex
+{
+    static inline thread_local bool held = false;
+
+    void lock()
+    {
+        _mtx.lock();
+        held = true;
+    }
+
+    void unlock()
+    {
+        held = false;
+        _mtx.unlock();
+    }
+
+    bool try_lock()
+    {
+        held = _mtx.try_lock();
+        return held;
+    }
+
+    std::mutex _mtx;
+};
+
+using cache::listener::Cause;
+using Removal = cache::listener::Removal<int, std::string>;
+
+struct Log
+{
+    std::vector<Removal> removals;
+    int                  underLock = 0;
+
+    [[nodiscard]] int count(Cause cause) const
+    {
+        int n = 0;
+        for (const auto& r : removals)
+        {
+            n += r.cause == cause ? 1 : 0;
+        }
+        return n;
+    }
+};
+
+static void test_causes()
+{
+    std::cout << "\n=== causes ===\n";
+    using Cache = cache::Base<int, std::string, cache::strategy::LRU<int, std::string>, std::hash<int>, std::equal_to<int>, TrackingMutex>;
+    Cache c(4);
+    Log   log;
+    c.setRemovalListener([&log](Removal&& r) {
+        log.underLock += TrackingMutex::held ? 1 : 0;
+        log.removals.push_back(std::move(r));
+    });
+
+    for (int i = 0; i < 6; ++i)
+    {
+        c.put(i, "v" + std::to_string(i));
+    }
+    check_eq("evictions reported as SIZE", log.count(Cause::SIZE), 2);
+    check_eq("oldest entry evicted first", log.removals.front().key, 0);
+    check_eq("evicted value handed over", log.removals.front().value, std::string("v0"));
+
+    c.put(5, "new");
+    check_eq("overwrite reported as REPLACED", log.count(Cause::REPLACED), 1);
+    check_eq("old value reported", log.removals.back().value, std::string("v5"));
+
+    c.remove(4);
+    check_eq("remove reported as EXPLICIT", log.count(Cause::EXPLICIT), 1);
+
+    c.invalidateIf([](const int& k, const std::string&) { return k == 3; });
+    std::string out;
+    (void) c.get(3, out);
+    c.clearInvalidationPredicate();
+    check_eq("invalidation reported as INVALIDATED", log.count(Cause::INVALIDATED), 1);
+
+    c.clear();
+    check_eq("clear reported as EXPLICIT", log.count(Cause::EXPLICIT), 3);
+    check_eq("listener never runs under the lock", log.underLock, 0);
+
+    c.setRemovalListener(nullptr);
+    c.put(1, "x");
+    c.remove(1);
+    check_eq("detached listener not called", log.removals.size(), std::size_t(7));
+}
+
+static void test_throwing_listener()
+{
+    std::cout << "\n=== throwing listener ===\n";
+    cache::Base<int, std::string> c(2);
+    int                           calls = 0;
+    c.setRemovalListener([&calls](Removal&&) {
+        ++calls;
+        throw std::runtime_error("listener failure");
+    });
+    for (int i = 0; i < 5; ++i)
+    {
+        c.put(i, "v");
+    }
+    check_eq("every removal attempted", calls, 3);
+    check_eq("cache unaffected", c.size(), std::size_t(2));
+}
+
+static void test_allocator_aware_values()
+{
+    std::cout << "\n=== allocator-aware values ===\n";
+    using Cache = cache::Base<int, std::pmr::string>;
+    Cache                        c(2, std::pmr::get_default_resource(), cache::memory::Allocation::SLAB);
+    std::vector<std::pmr::string> seen;
+    c.setRemovalListener([&seen](cache::listener::Removal<int, std::pmr::string>&& r) { seen.push_back(std::move(r.value)); });
+    for (int i = 0; i < 4; ++i)
+    {
+        c.put(i, std::pmr::string(100, static_cast<char>('a' + i)));
+    }
+    check_eq("evictions reported", seen.size(), std::size_t(2));
+    check_true("value copied out of the cache's slab", seen.front().get_allocator().resource() == std::pmr::get_default_resource());
+    check_eq("value contents", std::string(seen.front()), std::string(100, 'a'));
+}
+
+static void test_async()
+{
+    std::cout << "\n=== asynchronous dispatch ===\n";
+    std::atomic<int>                               received{0};
+    std::thread::id                                worker;
+    cache::listener::AsyncListener<int, std::string> async(
+        [&](Removal&&) {
+            worker = std::this_thread::get_id();
+            ++received;
+        },
+        8);
+    cache::Base<int, std::string> c(16);
+    c.setRemovalListener(async);
+    for (int i = 0; i < 1000; ++i)
+    {
+        c.put(i, std::to_string(i));
+    }
+    async.flush();
+    check_eq("every eviction delivered", received.load(), 1000 - 16);
+    check_eq("delivered() agrees", async.delivered(), std::uint64_t(1000 - 16));
+    check_true("delivered on the worker thread", worker != std::this_thread::get_id());
+
+    cache::listener::AsyncListener<int, std::string> dropping(
+        [](Removal&&) { std::this_thread::sleep_for(std::chrono::milliseconds(20)); }, 1, cache::listener::Overflow::DROP);
+    cache::Base<int, std::string> d(1);
+    d.setRemovalListener(dropping);
+    for (int i = 0; i < 20; ++i)
+    {
+        d.put(i, "v");
+    }
+    dropping.flush();
+    check_true("full queue drops removals", dropping.dropped() > 0);
+    check_eq("delivered and dropped cover every removal", dropping.delivered() + dropping.dropped(), std::uint64_t(19));
+}
+
+static void test_containers()
+{
+    std::cout << "\n=== every container ===\n";
+    std::atomic<int> fragmented{0};
+    using Fragmented = cache::Fragmented<int, std::string, cache::strategy::LRU<int, std::string>, std::hash<int>, std::equal_to<int>, std::shared_mutex, std::mutex>;
+    Fragmented f(4, 16);
+    f.setRemovalListener([&fragmented](Removal&&) { ++fragmented; });
+    for (int i = 0; i < 100; ++i)
+    {
+        f.put(i, "v");
+    }
+    const int evicted = fragmented.load();
+    check_eq("fragmented evictions reported", evicted, 100 - static_cast<int>(f.size()));
+    f.clear();
+    check_eq("fragmented clear reported", fragmented.load(), 100);
+
+    int  shared = 0;
+    auto& s     = cache::Shared<int, std::string, cache::strategy::LRU<int, std::string>>::getInstance();
+    s.setRemovalListener([&shared](Removal&& r) {
+        shared += r.cause == Cause::SIZE ? 1 : 0;
+    });
+    s.initialize(4);
+    for (int i = 0; i < 10; ++i)
+    {
+        s.put(i, "v");
+    }
+    check_eq("listener set before initialize() reaches the shared cache", shared, 6);
+
+    std::atomic<int> sharedFragmented{0};
+    auto& sf = cache::SharedFragmented<int, std::string, cache::strategy::LRU<int, std::string>>::getInstance();
+    sf.initialize(2, 8);
+    sf.setRemovalListener([&sharedFragmented](Removal&&) { ++sharedFragmented; });
+    for (int i = 0; i < 50; ++i)
+    {
+        sf.put(i, "v");
+    }
+    sf.clear();
+    check_eq("shared fragmented removals reported", sharedFragmented.load(), 50);
+}
+
+int main()
+{
+    test_causes();
+    test_throwing_listener();
+    test_allocator_aware_values();
+    test_async();
+    test_containers();
+
+    std::cout << "\nAll removal listener tests done.\n";
+    return 0;
+}
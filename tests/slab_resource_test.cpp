@@ -0,0 +1,178 @@
+// Slab storage tests: size classes, page reuse across classes and caches storing values in slabs.
+#include <Cache/Base.hpp>
+#include <Cache/Fragmented.hpp>
+#include <Cache/Memory/CountingResource.hpp>
+#include <Cache/Memory/SlabResource.hpp>
+#include <Cache/Strategy/LRU.hpp>
+#include <Cache/Weigher/Weighers.hpp>
+#include <iostream>
+#include <memory_resource>
+#include <mutex>
+#include <shared_mutex>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+// Shared check helpers
+template <typename T>
+static void check_eq(const char* name, const T& got, const T& expected)
+{
+    if (got == expected)
+    {
+        std::cout << "[OK]   " << name << " | got=" << got << " expected=" << expected << "\n";
+    }
+    else
+    {
+        std::cout << "[FAIL] " << name << " | got=" << got << " expected=" << expected << "\n";
+    }
+}
+
+static void check_true(const char* name, bool cond)
+{
+    std::cout << (cond ? "[OK]   " : "[FAIL] ") << name << " | expected true\n";
+}
+
+static void check_false(const char* name, bool cond)
+{
+    std::cout << (!cond ? "[OK]   " : "[FAIL] ") << name << " | expected false\n";
+}
+
+static void test_size_classes()
+{
+    std::cout << "\n=== size classes ===\n";
+    cache::memory::SlabResource slab;
+    check_eq("smallest class", slab.chunkSize(1), std::size_t(32));
+    check_true("class fits the request", slab.chunkSize(100) >= 100);
+    check_true("classes are spaced by the growth factor", slab.chunkSize(1000) < 1300);
+    check_eq("big requests go upstream", slab.chunkSize(slab.pageSize()), std::size_t(0));
+    check_eq("over-aligned requests go upstream", slab.chunkSize(64, 4096), std::size_t(0));
+
+    bool threw = false;
+    try
+    {
+        cache::memory::SlabResource bad(std::pmr::get_default_resource(), 5000);
+    }
+    catch (const std::invalid_argument&)
+    {
+        threw = true;
+    }
+    check_true("page size must be a power of two", threw);
+}
+
+static void test_page_reassignment()
+{
+    std::cout << "\n=== page reassignment ===\n";
+    cache::memory::CountingResource upstream;
+    {
+        cache::memory::SlabResource slab(&upstream, 64 * 1024);
+        std::vector<void*>          small;
+        for (int i = 0; i < 4000; ++i)
+        {
+            small.push_back(slab.allocate(64));
+        }
+        const std::size_t pages = slab.pages();
+        check_true("small chunks fill several pages", pages > 1);
+        check_eq("every chunk is live", slab.liveBlocks(), std::size_t(4000));
+        for (void* p : small)
+        {
+            slab.deallocate(p, 64);
+        }
+        check_eq("drained pages are pooled", slab.freePages(), pages);
+
+        std::vector<void*> large;
+        for (int i = 0; i < 200; ++i)
+        {
+            large.push_back(slab.allocate(1000));
+        }
+        check_eq("another class reuses the pooled pages", slab.pages(), pages);
+        check_true("pages changed class", slab.reassignments() > 0);
+        check_false("release refused while chunks are live", slab.release());
+        for (void* p : large)
+        {
+            slab.deallocate(p, 1000);
+        }
+        check_true("release accepted once empty", slab.release());
+        check_eq("pages handed back upstream", upstream.bytes(), std::size_t(0));
+
+        void* big = slab.allocate(1 << 20);
+        check_eq("big block counted", slab.liveBlocks(), std::size_t(1));
+        slab.deallocate(big, 1 << 20);
+        check_eq("big block returned", upstream.bytes(), std::size_t(0));
+    }
+    check_eq("destructor frees every page", upstream.bytes(), std::size_t(0));
+}
+
+using ByteCache = cache::Base<int, std::pmr::string, cache::strategy::LRU<int, std::pmr::string>, std::hash<int>, std::equal_to<int>, std::shared_mutex,
+                              cache::stats::NoStats, cache::weigher::ByteSize>;
+
+// Shifts a byte-bounded cache from small to large values: the pages freed by evicting the
+// small values serve the large ones, so the slab does not keep both working sets.
+static void test_cache_values_in_slabs()
+{
+    std::cout << "\n=== cache values in slabs ===\n";
+    cache::memory::CountingResource upstream;
+    cache::memory::SlabResource     slab(&upstream, 64 * 1024);
+    {
+        ByteCache c(512 * 1024, &slab);
+        for (int i = 0; i < 20000; ++i)
+        {
+            c.put(i, std::pmr::string(200, 'a'));
+        }
+        const std::size_t smallPages = slab.pages();
+        for (int i = 0; i < 20000; ++i)
+        {
+            c.put(100000 + i, std::pmr::string(2000, 'b'));
+        }
+        check_true("values were moved into other classes", slab.reassignments() > 0);
+        check_true("footprint stays near one working set", slab.pages() < smallPages * 3 / 2);
+
+        std::pmr::string out;
+        check_true("latest value readable", c.get(119999, out));
+        check_eq("value contents", out.size(), std::size_t(2000));
+        check_true("weight stays within the budget", c.weight() <= c.capacity());
+    }
+    check_eq("cache returns every chunk", slab.liveBlocks(), std::size_t(0));
+}
+
+static void test_owned_slab()
+{
+    std::cout << "\n=== Allocation::SLAB ===\n";
+    cache::memory::CountingResource upstream;
+    {
+        ByteCache c(256 * 1024, &upstream, cache::memory::Allocation::SLAB);
+        for (int i = 0; i < 5000; ++i)
+        {
+            c.put(i, std::pmr::string(static_cast<std::size_t>(50 + i % 500), 'x'));
+        }
+        const std::size_t full = upstream.bytes();
+        c.clear();
+        check_true("clear hands the slab pages back", upstream.bytes() < full);
+        c.put(1, std::pmr::string("one"));
+        std::pmr::string out;
+        check_true("usable after clear", c.get(1, out));
+        check_eq("value after clear", std::string(out), std::string("one"));
+    }
+    check_eq("everything returned on destruction", upstream.bytes(), std::size_t(0));
+
+    using Fragmented = cache::Fragmented<int, std::pmr::string, cache::strategy::LRU<int, std::pmr::string>, std::hash<int>, std::equal_to<int>,
+                                         std::shared_mutex, std::mutex>;
+    Fragmented f(4, 1024, std::pmr::get_default_resource(), cache::memory::Allocation::SLAB);
+    for (int i = 0; i < 4000; ++i)
+    {
+        f.put(i, std::pmr::string(300, 'f'));
+    }
+    std::pmr::string out;
+    check_true("fragments store values in their own slabs", f.get(3999, out));
+    check_eq("fragmented value", out.size(), std::size_t(300));
+}
+
+int main()
+{
+    test_size_classes();
+    test_page_reassignment();
+    test_cache_values_in_slabs();
+    test_owned_slab();
+
+    std::cout << "\nAll slab resource tests done.\n";
+    return 0;
+}
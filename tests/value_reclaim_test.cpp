@@ -0,0 +1,245 @@
+// putReclaim() tests: dropped entries are handed back by move so their buffers can be reused.
+#include <Cache/Base.hpp>
+#include <Cache/Fragmented.hpp>
+#include <Cache/Strategy/LRU.hpp>
+#include <cstdlib>
+#include <iostream>
+#include <mutex>
+#include <new>
+#include <shared_mutex>
+#include <string>
+#include <vector>
+
+static std::size_t allocations = 0;
+
+// Every replaceable form is provided, so that all of them agree on malloc() and free(). The
+// deallocation functions stay out of line: inlined, GCC warns about free() on the result of
+// operator new (-Wmismatched-new-delete).
+static void* countedAlloc(std::size_t size) noexcept
+{
+    ++allocations;
+    return std::malloc(size == 0 ? 1 : size);
+}
+
+void* operator new(std::size_t size)
+{
+    if (void* p = countedAlloc(size))
+    {
+        return p;
+    }
+    throw std::bad_alloc();
+}
+
+void* operator new[](std::size_t size)
+{
+    return operator new(size);
+}
+
+void* operator new(std::size_t size, const std::nothrow_t&) noexcept
+{
+    return countedAlloc(size);
+}
+
+void* operator new[](std::size_t size, const std::nothrow_t&) noexcept
+{
+    return countedAlloc(size);
+}
+
+[[gnu::noinline]] void operator delete(void* p) noexcept
+{
+    std::free(p);
+}
+
+[[gnu::noinline]] void operator delete[](void* p) noexcept
+{
+    std::free(p);
+}
+
+[[gnu::noinline]] void operator delete(void* p, std::size_t) noexcept
+{
+    std::free(p);
+}
+
+[[gnu::noinline]] void operator delete[](void* p, std::size_t) noexcept
+{
+    std::free(p);
+}
+
+[[gnu::noinline]] void operator delete(void* p, const std::nothrow_t&) noexcept
+{
+    std::free(p);
+}
+
+[[gnu::noinline]] void operator delete[](void* p, const std::nothrow_t&) noexcept
+{
+    std::free(p);
+}
+
+// Shared check helpers
+template <typename T>
+static void check_eq(const char* name, const T& got, const T& expected)
+{
+    if (got == expected)
+    {
+        std::cout << "[OK]   " << name << " | got=" << got << " expected=" << expected << "\n";
+    }
+    else
+    {
+        std::cout << "[FAIL] " << name << " | got=" << got << " expected=" << expected << "\n";
+    }
+}
+
+static void check_true(const char* name, bool cond)
+{
+    std::cout << (cond ? "[OK]   " : "[FAIL] ") << name << " | expected true\n";
+}
+
+using Tile      = std::vector<unsigned char>;
+using TileCache = cache::Base<int, Tile>;
+using Removal   = TileCache::Removal;
+
+static void test_evicted_entry_returned()
+{
+    std::cout << "\n=== evicted entry returned ===\n";
+    TileCache            c(2);
+    std::vector<Removal> reclaimed;
+    check_true("first put stored", c.putReclaim(1, Tile(64, 1), reclaimed));
+    check_true("second put stored", c.putReclaim(2, Tile(64, 2), reclaimed));
+    check_eq("nothing dropped while there is room", reclaimed.size(), std::size_t(0));
+
+    Tile                 first(64, 1);
+    const unsigned char* buffer = first.data();
+    c.remove(1);
+    c.putReclaim(1, std::move(first), reclaimed);
+    c.putReclaim(3, Tile(64, 3), reclaimed);
+    check_eq("victim handed back", reclaimed.size(), std::size_t(1));
+    check_eq("victim key", reclaimed.front().key, 2);
+    check_true("victim cause", reclaimed.front().cause == cache::listener::Cause::SIZE);
+
+    reclaimed.clear();
+    c.putReclaim(4, Tile(64, 4), reclaimed);
+    check_eq("oldest entry handed back", reclaimed.front().key, 1);
+    check_true("its buffer was moved, not copied", reclaimed.front().value.data() == buffer);
+
+    reclaimed.clear();
+    c.putReclaim(4, Tile(64, 5), reclaimed);
+    check_true("overwritten value handed back", reclaimed.size() == 1 && reclaimed.front().cause == cache::listener::Cause::REPLACED);
+    check_eq("old contents", static_cast<int>(reclaimed.front().value.front()), 4);
+    Tile out;
+    check_true("new value stored", c.get(4, out) && out.front() == 5);
+}
+
+static void test_listener_bypassed()
+{
+    std::cout << "\n=== removal listener ===\n";
+    TileCache c(1);
+    int       reported = 0;
+    c.setRemovalListener([&reported](Removal&&) { ++reported; });
+    std::vector<Removal> reclaimed;
+    c.putReclaim(1, Tile(8), reclaimed);
+    c.putReclaim(2, Tile(8), reclaimed);
+    check_eq("reclaimed entries bypass the listener", reported, 0);
+    check_eq("reclaimed instead", reclaimed.size(), std::size_t(1));
+    c.put(3, Tile(8));
+    check_eq("plain put still reported", reported, 1);
+}
+
+static void test_pool()
+{
+    std::cout << "\n=== object pool ===\n";
+    TileCache         c(4);
+    std::vector<Tile> pool;
+    for (int i = 0; i < 10; ++i)
+    {
+        c.putReclaim(i, Tile(32, static_cast<unsigned char>(i)), [&pool](Removal&& r) { pool.push_back(std::move(r.value)); });
+    }
+    check_eq("every victim pooled", pool.size(), std::size_t(6));
+    check_eq("pooled buffer keeps its size", pool.front().size(), std::size_t(32));
+}
+
+// Tiles are recycled through the pool and map nodes through the arena: once warm, the cache
+// runs without touching the heap.
+static void test_steady_state()
+{
+    std::cout << "\n=== steady state ===\n";
+    TileCache            c(64, std::pmr::get_default_resource(), cache::memory::Allocation::ARENA);
+    std::vector<Tile>    pool;
+    std::vector<Removal> reclaimed;
+    reclaimed.reserve(4);
+    pool.reserve(4);
+    auto step = [&](int key) {
+        Tile tile;
+        if (pool.empty())
+        {
+            tile.resize(4096);
+        }
+        else
+        {
+            tile = std::move(pool.back());
+            pool.pop_back();
+        }
+        tile[0] = static_cast<unsigned char>(key);
+        c.putReclaim(key, std::move(tile), reclaimed);
+        for (auto& removal : reclaimed)
+        {
+            pool.push_back(std::move(removal.value));
+        }
+        reclaimed.clear();
+    };
+    for (int i = 0; i < 1000; ++i)
+    {
+        step(i);
+    }
+    const std::size_t before = allocations;
+    for (int i = 1000; i < 20000; ++i)
+    {
+        step(i);
+    }
+    check_eq("no heap allocation once warm", allocations - before, std::size_t(0));
+    Tile out;
+    check_true("latest tile readable", c.get(19999, out) && out[0] == static_cast<unsigned char>(19999));
+}
+
+// Plain put() of an entry whose destruction is deferred: the retired entry is parked without
+// taking the cache's buffer, so an evicting put allocates nothing once warm.
+static void test_steady_state_put()
+{
+    std::cout << "\n=== steady state put ===\n";
+    cache::Base<std::string, int> c(64, std::pmr::get_default_resource(), cache::memory::Allocation::ARENA);
+    for (int i = 0; i < 1000; ++i)
+    {
+        c.put(std::to_string(i), i);
+    }
+    const std::size_t before = allocations;
+    for (int i = 1000; i < 20000; ++i)
+    {
+        c.put(std::to_string(i), i);
+    }
+    check_eq("evicting put allocates nothing once warm", allocations - before, std::size_t(0));
+    check_eq("still at capacity", c.size(), std::size_t(64));
+}
+
+static void test_fragmented()
+{
+    std::cout << "\n=== fragmented ===\n";
+    cache::Fragmented<int, Tile, cache::strategy::LRU<int, Tile>, std::hash<int>, std::equal_to<int>, std::shared_mutex, std::mutex> f(4, 16);
+    std::vector<Removal> reclaimed;
+    for (int i = 0; i < 100; ++i)
+    {
+        f.putReclaim(i, Tile(16), reclaimed);
+    }
+    check_eq("every victim handed back", reclaimed.size(), 100 - f.size());
+}
+
+int main()
+{
+    test_evicted_entry_returned();
+    test_listener_bypassed();
+    test_pool();
+    test_steady_state();
+    test_steady_state_put();
+    test_fragmented();
+
+    std::cout << "\nAll value reclaim tests done.\n";
+    return 0;
+}
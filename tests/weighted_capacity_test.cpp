@@ -0,0 +1,209 @@
+// Weighted capacity tests.
+#include <Cache/Base.hpp>
+#include <Cache/Fragmented.hpp>
+#include <Cache/Strategy/FIFO.hpp>
+#include <Cache/Strategy/LRU.hpp>
+#include <Cache/Strategy/SLRU.hpp>
+#include <Cache/Weigher/Weighers.hpp>
+#include <iostream>
+#include <mutex>
+#include <shared_mutex>
+#include <string>
+
+// Shared check helpers
+template <typename T>
+static void check_eq(const char* name, const T& got, const T& expected)
+{
+    if (got == expected)
+    {
+        std::cout << "[OK]   " << name << " | got=" << got << " expected=" << expected << "\n";
+    }
+    else
+    {
+        std::cout << "[FAIL] " << name << " | got=" << got << " expected=" << expected << "\n";
+    }
+}
+
+static void check_true(const char* name, bool cond)
+{
+    std::cout << (cond ? "[OK]   " : "[FAIL] ") << name << " | expected true\n";
+}
+
+static void check_false(const char* name, bool cond)
+{
+    std::cout << (!cond ? "[OK]   " : "[FAIL] ") << name << " | expected false\n";
+}
+
+// Weight = value length, so tests can reason in exact units.
+struct LengthWeigher
+{
+    std::size_t operator()(const int&, const std::string& value) const noexcept
+    {
+        return value.size();
+    }
+};
+
+template <typename Strategy = cache::strategy::LRU<int, std::string>>
+using WeightedCache = cache::Base<int, std::string, Strategy, std::hash<int>, std::equal_to<int>, std::shared_mutex, cache::stats::StripedStats<>, LengthWeigher>;
+
+static void test_unit_default()
+{
+    std::cout << "\n=== unit weigher ===\n";
+    cache::Base<int, int> c(3);
+    c.put(1, 1);
+    c.put(2, 2);
+    check_eq("weight() equals size()", c.weight(), c.size());
+    check_true("Unit is a unit weigher", cache::weigher::isUnit<cache::weigher::Unit>);
+    check_false("ByteSize is not a unit weigher", cache::weigher::isUnit<cache::weigher::ByteSize>);
+    check_false("custom weigher is not a unit weigher", cache::weigher::isUnit<LengthWeigher>);
+}
+
+static void test_evicts_until_fits()
+{
+    std::cout << "\n=== evicts until the entry fits ===\n";
+    WeightedCache<> c(10);
+    c.put(1, std::string(3, 'a'));
+    c.put(2, std::string(3, 'b'));
+    c.put(3, std::string(3, 'c'));
+    check_eq("weight() after three puts", c.weight(), std::size_t(9));
+    check_eq("size() after three puts", c.size(), std::size_t(3));
+
+    c.put(4, std::string(7, 'd'));
+    check_eq("weight() after heavy put", c.weight(), std::size_t(10));
+    check_eq("size() after heavy put", c.size(), std::size_t(2));
+    check_false("oldest evicted", c.contains(1));
+    check_false("second oldest evicted", c.contains(2));
+    check_true("third kept", c.contains(3));
+    check_true("heavy entry inserted", c.contains(4));
+    check_eq("evictions counted", c.stats().evictions, std::uint64_t(2));
+}
+
+static void test_too_heavy()
+{
+    std::cout << "\n=== entry heavier than capacity ===\n";
+    WeightedCache<> c(10);
+    c.put(1, std::string(4, 'a'));
+    c.put(2, std::string(11, 'b'));
+    check_false("heavy entry rejected", c.contains(2));
+    check_true("existing entry untouched", c.contains(1));
+    check_eq("weight() unchanged", c.weight(), std::size_t(4));
+
+    c.put(1, std::string(20, 'a'));
+    check_false("update over capacity drops the entry", c.contains(1));
+    check_eq("weight() after dropped update", c.weight(), std::size_t(0));
+}
+
+static void test_update_weight()
+{
+    std::cout << "\n=== update changes weight ===\n";
+    WeightedCache<> c(10);
+    c.put(1, std::string(3, 'a'));
+    c.put(2, std::string(3, 'b'));
+    c.put(3, std::string(3, 'c'));
+    c.put(3, std::string(1, 'c'));
+    check_eq("weight() after lighter update", c.weight(), std::size_t(7));
+    c.put(3, std::string(6, 'c'));
+    check_eq("weight() after heavier update", c.weight(), std::size_t(9));
+    check_false("LRU entry evicted to fit update", c.contains(1));
+    check_true("updated entry kept", c.contains(3));
+
+    c.remove(2);
+    check_eq("weight() after remove", c.weight(), std::size_t(6));
+    c.clear();
+    check_eq("weight() after clear", c.weight(), std::size_t(0));
+}
+
+static void test_invalidation_weight()
+{
+    std::cout << "\n=== invalidation releases weight ===\n";
+    WeightedCache<> c(10);
+    c.put(1, std::string(4, 'a'));
+    c.put(2, std::string(4, 'b'));
+    c.invalidateIf([](const int& k, const std::string&) { return k == 1; });
+    std::string out;
+    check_false("invalidated entry misses", c.get(1, out));
+    check_eq("weight() after invalidation", c.weight(), std::size_t(4));
+}
+
+static void test_shrink_weight()
+{
+    std::cout << "\n=== shrinking the weight budget ===\n";
+    WeightedCache<cache::strategy::FIFO<int, std::string>> c(100);
+    for (int i = 0; i < 10; ++i)
+    {
+        c.put(i, std::string(10, 'x'));
+    }
+    c.setCapacity(35);
+    check_eq("weight() trimmed under new budget", c.weight(), std::size_t(30));
+    check_eq("size() after shrink", c.size(), std::size_t(3));
+    check_true("newest kept", c.contains(9));
+}
+
+static void test_slru_weighted()
+{
+    std::cout << "\n=== SLRU weighted ===\n";
+    WeightedCache<cache::strategy::SLRU<int, std::string>> c(50);
+    std::string                                            out;
+    bool                                                   bounded = true;
+    for (int i = 0; i < 200; ++i)
+    {
+        c.put(i, std::string(1 + i % 9, 'x'));
+        (void) c.get(i / 2, out);
+        bounded = bounded && c.weight() <= 50;
+    }
+    check_true("SLRU weight stays within budget", bounded);
+    check_true("SLRU keeps entries", c.size() > 0);
+}
+
+static void test_byte_size()
+{
+    std::cout << "\n=== ByteSize weigher ===\n";
+    using Cache = cache::Base<int, std::string, cache::strategy::LRU<int, std::string>, std::hash<int>, std::equal_to<int>, std::mutex, cache::stats::NoStats,
+                              cache::weigher::ByteSize>;
+    const std::size_t entry = sizeof(int) + sizeof(std::string) + 1001;
+    Cache             c(entry * 4);
+    for (int i = 0; i < 10; ++i)
+    {
+        c.put(i, std::string(1000, 'x'));
+    }
+    check_eq("ByteSize keeps four 1000-byte values", c.size(), std::size_t(4));
+    check_eq("ByteSize weight()", c.weight(), entry * 4);
+
+    // Assigning a short string keeps the long one's buffer: the weight removed later must be
+    // the one that was added.
+    Cache replaced(100000);
+    replaced.put(2, std::string(3000, 'z'));
+    replaced.put(2, std::string(100, 'y'));
+    replaced.remove(2);
+    check_eq("weight back to 0 after replace then remove", replaced.weight(), std::size_t(0));
+}
+
+static void test_fragmented_weighted()
+{
+    std::cout << "\n=== fragmented weighted ===\n";
+    using Cache = cache::Fragmented<int, std::string, cache::strategy::LRU<int, std::string>, std::hash<int>, std::equal_to<int>, std::shared_mutex, std::mutex,
+                                    cache::stats::NoStats, LengthWeigher>;
+    Cache c(2, 20);
+    for (int i = 0; i < 20; ++i)
+    {
+        c.put(i, std::string(4, 'x'));
+    }
+    check_eq("fragmented weight() at budget", c.weight(), std::size_t(16));
+    check_eq("fragmented size()", c.size(), std::size_t(4));
+}
+
+int main()
+{
+    test_unit_default();
+    test_evicts_until_fits();
+    test_too_heavy();
+    test_update_weight();
+    test_invalidation_weight();
+    test_shrink_weight();
+    test_slru_weighted();
+    test_byte_size();
+    test_fragmented_weighted();
+
+    std::cout << "\nAll weighted capacity tests done.\n";
+    return 0;
+}
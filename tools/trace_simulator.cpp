@@ -0,0 +1,328 @@
+// Trace-driven hit-ratio simulator: replays an access trace against every strategy at
+// several capacities (in parallel) and prints the hit-ratio curve as CSV.
+//
+// Build: g++ tools/trace_simulator.cpp -I . --std=c++20 -O2 -pthread -o trace_simulator
+//
+// Options (`name=value`):
+//   file=PATH            trace to replay (required)
+//   format=F             csv (default), bin, arc, spc or ctrace
+//                          csv: one key per line, first comma-separated column; non-numeric keys are hashed
+//                          bin: raw little-endian uint64 keys
+//                          arc: "start count ignored request" block ranges (ARC/LIRS traces)
+//                          spc: "asu,lba,size,opcode,timestamp" (UMass storage traces), key = asu:lba
+//                          ctrace: files written by cache::trace::AccessTracer; GET records are replayed
+//   capacities=N[,N...]  cache sizes in entries, at least 1 (default: 0.1% .. 50% of the distinct keys)
+//   strategies=S[,S...]  subset of LRU, MRU, FIFO, LFU, HalvedLFU, RedisLFU, SLRU, 2Q (default all)
+//   threads=N            worker threads (default: hardware concurrency)
+#include <Cache/Base.hpp>
+#include <Cache/Helpers/MutexLocks.hpp>
+#include <Cache/Strategy/2Q.hpp>
+#include <Cache/Strategy/FIFO.hpp>
+#include <Cache/Strategy/HalvedLFU.hpp>
+#include <Cache/Strategy/LFU.hpp>
+#include <Cache/Strategy/LRU.hpp>
+#include <Cache/Strategy/MRU.hpp>
+#include <Cache/Strategy/RedisLFU.hpp>
+#include <Cache/Strategy/SLRU.hpp>
+#include <Cache/Trace/AccessTracer.hpp>
+#include <algorithm>
+#include <atomic>
+#include <charconv>
+#include <cstdint>
+#include <cstdio>
+#include <fstream>
+#include <functional>
+#include <iostream>
+#include <map>
+#include <sstream>
+#include <stdexcept>
+#include <string>
+#include <string_view>
+#include <thread>
+#include <unordered_set>
+#include <vector>
+
+namespace
+{
+    using K = std::uint64_t;
+    using V = std::uint8_t;
+
+    struct Options
+    {
+        std::string              file;
+        std::string              format = "csv";
+        std::vector<std::size_t> capacities;
+        std::vector<std::string> strategies = {"LRU", "MRU", "FIFO", "LFU", "HalvedLFU", "RedisLFU", "SLRU", "2Q"};
+        std::size_t              threads    = std::max(1U, std::thread::hardware_concurrency());
+    };
+
+    std::vector<std::string> split(const std::string& s, char sep)
+    {
+        std::vector<std::string> res;
+        std::stringstream        ss(s);
+        std::string              item;
+        while (std::getline(ss, item, sep))
+        {
+            res.push_back(item);
+        }
+        return res;
+    }
+
+    Options parseOptions(int argc, char** argv)
+    {
+        Options opts;
+        for (int i = 1; i < argc; ++i)
+        {
+            const std::string arg = argv[i];
+            const auto        eq  = arg.find('=');
+            if (eq == std::string::npos)
+            {
+                throw(std::invalid_argument("Expected name=value, got: " + arg));
+            }
+            const std::string name  = arg.substr(0, eq);
+            const std::string value = arg.substr(eq + 1);
+            if (name == "file")
+            {
+                opts.file = value;
+            }
+            else if (name == "format")
+            {
+                opts.format = value;
+            }
+            else if (name == "capacities")
+            {
+                for (const auto& c : split(value, ','))
+                {
+                    const std::size_t cap = std::stoul(c);
+                    if (cap == 0)
+                    {
+                        throw(std::invalid_argument("Capacities must be positive, got: " + c));
+                    }
+                    opts.capacities.push_back(cap);
+                }
+            }
+            else if (name == "strategies")
+            {
+                opts.strategies = split(value, ',');
+            }
+            else if (name == "threads")
+            {
+                opts.threads = std::max<std::size_t>(1, std::stoul(value));
+            }
+            else
+            {
+                throw(std::invalid_argument("Unknown option: " + name));
+            }
+        }
+        if (opts.file.empty())
+        {
+            throw(std::invalid_argument("Missing file=PATH"));
+        }
+        return opts;
+    }
+
+    [[nodiscard]] K parseKey(std::string_view field)
+    {
+        while (!field.empty() && (field.front() == ' ' || field.front() == '\t'))
+        {
+            field.remove_prefix(1);
+        }
+        while (!field.empty() && (field.back() == ' ' || field.back() == '\t' || field.back() == '\r'))
+        {
+            field.remove_suffix(1);
+        }
+        K    key = 0;
+        auto res = std::from_chars(field.data(), field.data() + field.size(), key);
+        if (res.ec == std::errc() && res.ptr == field.data() + field.size())
+        {
+            return key;
+        }
+        return std::hash<std::string_view>{}(field);
+    }
+
+    [[nodiscard]] std::vector<K> readTrace(const Options& opts)
+    {
+        std::ifstream in(opts.file, std::ios::binary);
+        if (!in)
+        {
+            throw(std::runtime_error("Cannot open trace: " + opts.file));
+        }
+
+        std::vector<K> trace;
+        if (opts.format == "ctrace")
+        {
+            for (const auto& r : cache::trace::readTraceFile(opts.file))
+            {
+                if (r.op == cache::trace::Op::GET)
+                {
+                    trace.push_back(r.keyHash);
+                }
+            }
+            return trace;
+        }
+        if (opts.format == "bin")
+        {
+            K key = 0;
+            while (in.read(reinterpret_cast<char*>(&key), sizeof(key)))
+            {
+                trace.push_back(key);
+            }
+            return trace;
+        }
+
+        std::string line;
+        while (std::getline(in, line))
+        {
+            if (line.empty() || line[0] == '#')
+            {
+                continue;
+            }
+            if (opts.format == "csv")
+            {
+                trace.push_back(parseKey(std::string_view(line).substr(0, line.find(','))));
+            }
+            else if (opts.format == "arc")
+            {
+                std::istringstream fields(line);
+                K                  start = 0;
+                K                  count = 0;
+                if (fields >> start >> count)
+                {
+                    for (K b = 0; b < count; ++b)
+                    {
+                        trace.push_back(start + b);
+                    }
+                }
+            }
+            else if (opts.format == "spc")
+            {
+                const auto fields = split(line, ',');
+                if (fields.size() >= 2)
+                {
+                    trace.push_back((parseKey(fields[0]) << 48) ^ parseKey(fields[1]));
+                }
+            }
+            else
+            {
+                throw(std::invalid_argument("Unknown format: " + opts.format));
+            }
+        }
+        return trace;
+    }
+
+    template <template <typename, typename> class S>
+    [[nodiscard]] std::uint64_t replay(const std::vector<K>& trace, std::size_t capacity)
+    {
+        cache::Base<K, V, S<K, V>, std::hash<K>, std::equal_to<K>, cache::mutex_locks::NoLock> c(capacity);
+        std::uint64_t                                                                          hits = 0;
+        V                                                                                      out{};
+        for (K key : trace)
+        {
+            if (c.get(key, out))
+            {
+                ++hits;
+            }
+            else
+            {
+                c.put(key, 0);
+            }
+        }
+        return hits;
+    }
+
+    using ReplayFn = std::uint64_t (*)(const std::vector<K>&, std::size_t);
+
+    const std::map<std::string, ReplayFn>& replayers()
+    {
+        static const std::map<std::string, ReplayFn> table = {
+            {"LRU", &replay<cache::strategy::LRU>},
+            {"MRU", &replay<cache::strategy::MRU>},
+            {"FIFO", &replay<cache::strategy::FIFO>},
+            {"LFU", &replay<cache::strategy::LFU>},
+            {"HalvedLFU", &replay<cache::strategy::HalvedLFU>},
+            {"RedisLFU", &replay<cache::strategy::RedisLFU>},
+            {"SLRU", &replay<cache::strategy::SLRU>},
+            {"2Q", &replay<cache::strategy::TwoQueues>},
+        };
+        return table;
+    }
+
+    [[nodiscard]] std::vector<std::size_t> defaultCapacities(const std::vector<K>& trace)
+    {
+        const std::size_t        distinct = std::unordered_set<K>(trace.begin(), trace.end()).size();
+        std::vector<std::size_t> res;
+        for (double f : {0.001, 0.002, 0.005, 0.01, 0.02, 0.05, 0.1, 0.2, 0.5})
+        {
+            const std::size_t cap = std::max<std::size_t>(1, static_cast<std::size_t>(f * static_cast<double>(distinct)));
+            if (res.empty() || res.back() != cap)
+            {
+                res.push_back(cap);
+            }
+        }
+        return res;
+    }
+
+    struct Job
+    {
+        std::string   strategy;
+        std::size_t   capacity;
+        std::uint64_t hits = 0;
+    };
+} // namespace
+
+int main(int argc, char** argv)
+{
+    try
+    {
+        Options              opts  = parseOptions(argc, argv);
+        const std::vector<K> trace = readTrace(opts);
+        if (opts.capacities.empty())
+        {
+            opts.capacities = defaultCapacities(trace);
+        }
+
+        std::vector<Job> jobs;
+        for (const auto& s : opts.strategies)
+        {
+            if (!replayers().contains(s))
+            {
+                throw(std::invalid_argument("Unknown strategy: " + s));
+            }
+            for (std::size_t cap : opts.capacities)
+            {
+                jobs.push_back({s, cap});
+            }
+        }
+
+        std::atomic<std::size_t> next{0};
+        std::vector<std::thread> workers;
+        for (std::size_t t = 0; t < std::min(opts.threads, jobs.size()); ++t)
+        {
+            workers.emplace_back(
+                [&]
+                {
+                    for (std::size_t i = next++; i < jobs.size(); i = next++)
+                    {
+                        jobs[i].hits = replayers().at(jobs[i].strategy)(trace, jobs[i].capacity);
+                    }
+                });
+        }
+        for (auto& w : workers)
+        {
+            w.join();
+        }
+
+        std::printf("strategy,capacity,accesses,hits,hit_ratio\n");
+        for (const auto& job : jobs)
+        {
+            std::printf("%s,%zu,%zu,%llu,%.6f\n", job.strategy.c_str(), job.capacity, trace.size(), static_cast<unsigned long long>(job.hits),
+                        trace.empty() ? 0.0 : static_cast<double>(job.hits) / static_cast<double>(trace.size()));
+        }
+    }
+    catch (const std::exception& e)
+    {
+        std::cerr << "trace_simulator: " << e.what() << "\n";
+        return 1;
+    }
+    return 0;
+}